@@ -2,20 +2,26 @@
 #include "tralics/AttList.h"
 #include "tralics/Token.h"
 
+namespace {
+    const TokenList empty_list;
+    const AttList   empty_atts;
+} // namespace
+
 // Adds a new <u>, <v>, and att-list slot
-void ArrayInfo::add_uv(TokenList &u, TokenList &v, const AttList &At) {
-    u_table.push_back(u);
-    v_table.push_back(v);
-    attribs.push_back(At);
+void ArrayInfo::add_uv(TokenList &&u, TokenList &&v, AttList &&At) {
+    u_table.push_back(std::move(u));
+    v_table.push_back(std::move(v));
+    attribs.push_back(std::move(At));
 }
 
-// This gets u-part or v-part
-auto ArrayInfo::get_u_or_v(bool u_or_v, size_t pos) const -> TokenList {
-    if (pos >= attribs.size()) return TokenList();
+// This gets u-part or v-part. The result is valid until the next add_uv,
+// the caller makes a copy only if it is not empty.
+auto ArrayInfo::get_u_or_v(bool u_or_v, size_t pos) const -> const TokenList & {
+    if (pos >= attribs.size()) return empty_list;
     return u_or_v ? u_table[pos] : v_table[pos];
 }
 
-auto ArrayInfo::get_cell_atts(size_t k) const -> AttList {
-    if (k >= attribs.size()) return AttList();
+auto ArrayInfo::get_cell_atts(size_t k) const -> const AttList & {
+    if (k >= attribs.size()) return empty_atts;
     return attribs[k];
 }
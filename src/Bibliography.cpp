@@ -1,6 +1,7 @@
 #include "tralics/Bibliography.h"
 #include "tralics/Bbl.h"
 #include "tralics/Bibtex.h"
+#include "tralics/Logger.h"
 #include "tralics/globals.h"
 #include <fmt/format.h>
 #include <spdlog/spdlog.h>
@@ -28,8 +29,10 @@ void Bibliography::dump_bibtex() {
 }
 
 void Bibliography::stats() {
-    auto solved = std::count_if(citation_table.begin(), citation_table.end(), [](auto &c) { return c.is_solved(); });
-    spdlog::trace("Bib stats: seen {}{} entries.", citation_table.size(), solved > 0 ? fmt::format("({})", solved) : "");
+    Logger::trace("Bib stats: seen {}{} entries.", citation_table.size(), [this] {
+        auto solved = std::count_if(citation_table.begin(), citation_table.end(), [](auto &c) { return c.is_solved(); });
+        return solved > 0 ? fmt::format("({})", solved) : std::string();
+    });
 }
 
 // This dumps the whole biblio for use by bibtex.
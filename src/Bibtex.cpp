@@ -104,7 +104,7 @@ namespace {
 // like miaou+foot. Prints a warning if this is a bad name.
 void Bibtex::read_bib_file(const std::string &s) {
     if (auto of = find_in_path(s + (s.ends_with(".bib") ? "" : ".bib")); of) {
-        spdlog::trace("Found BIB file: {}", *of);
+        Logger::trace("Found BIB file: {}", *of);
         bbl.format("% reading source {}", *of);
         bbl.flush();
         in_lines.read(of->string(), 1);
@@ -608,7 +608,7 @@ void Bibtex::work() {
     for (auto &all_entrie : all_entries) all_entrie->un_crossref();
     for (size_t i = 0; i < all_entries.size(); i++) all_entries[i]->work(to_signed(i));
     auto nb_entries = all_entries_table.size();
-    spdlog::trace("Seen {} bibliographic entries.", nb_entries);
+    Logger::trace("Seen {} bibliographic entries.", nb_entries);
     // Sort the entries
     std::sort(all_entries_table.begin(), all_entries_table.end(), [](auto a, auto b) { return a->sort_label < b->sort_label; });
     std::string previous_label;
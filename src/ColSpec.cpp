@@ -3,12 +3,18 @@
 
 // This creates a new color item, to be pushed on the color stack
 // Note that used is false, set to true by get_id.
-ColSpec::ColSpec(std::string a, std::string b, std::string c)
-    : name(std::move(a)), model(std::move(b)), value(std::move(c)), xval(the_names["color"], nullptr) {
-    if (!name.empty()) xval.id.add_attribute("name", name);
-    xval.id.add_attribute("model", model);
-    xval.id.add_attribute("value", value);
+ColSpec::ColSpec(std::string a, std::string b, std::string c) : name(std::move(a)), model(std::move(b)), value(std::move(c)) {
     static int n = 0;
     id           = fmt::format("colid{}", ++n); // This is a unique id
-    xval.id.add_attribute(the_names["id"], id);
+}
+
+// The element of the color pool. Only used colors are converted, at the
+// end of the run.
+auto ColSpec::to_xml() const -> Xml * {
+    auto *res = new Xml(the_names["color"], nullptr);
+    if (!name.empty()) res->id.add_attribute("name", name);
+    res->id.add_attribute("model", model);
+    res->id.add_attribute("value", value);
+    res->id.add_attribute(the_names["id"], id);
+    return res;
 }
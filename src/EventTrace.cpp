@@ -0,0 +1,147 @@
+#include "tralics/EventTrace.h"
+#include "tralics/Parser.h"
+#include "tralics/util.h"
+#include <fstream>
+#include <sstream>
+#include <spdlog/spdlog.h>
+
+// The file written by dump starts with the 8 bytes of trace_magic, and
+// the number of events recorded (64 bits). Then come the strings, the
+// events (7 words each) and the arguments, as string numbers. Each
+// section starts with its length, numbers are 32 bits in native order.
+// Arguments that were overwritten in the token ring have length no_span.
+
+namespace {
+    constexpr char     trace_magic[8] = {'T', 'R', 'A', 'C', 'E', 'X', 'T', '1'};
+    constexpr uint32_t no_span        = 0xFFFFFFFF;
+
+    void put_word(std::ostream &o, uint32_t x) { o.write(reinterpret_cast<const char *>(&x), sizeof(x)); }
+
+    // Text of a token in a token list, as in the transcript
+    auto list_text(Token t) -> std::string {
+        TokenList L;
+        L.push_back(t);
+        std::ostringstream o;
+        o << L;
+        return o.str();
+    }
+
+    // Name of a command, as print_cmd_chr in txtranslate.cpp
+    auto command_text(CmdChr x) -> std::string {
+        String      a   = x.special_name();
+        std::string res = "\\";
+        res += x.name();
+        if (a != nullptr) {
+            res += ' ';
+            res += a;
+        }
+        return res;
+    }
+
+    // Returns the number of the string associated to k; if there is none,
+    // f() is added to the table.
+    template <typename K, typename F> auto intern(std::unordered_map<K, uint32_t> &M, K k, std::vector<std::string> &S, F f) -> uint32_t {
+        auto [it, inserted] = M.try_emplace(k, uint32_t(S.size()));
+        if (inserted) S.push_back(f());
+        return it->second;
+    }
+} // namespace
+
+auto EventTrace::file_id() -> uint32_t {
+    const auto &f = the_parser.lines.file_name;
+    if (f != last_file) {
+        last_file    = f;
+        last_file_id = intern(files, f, strings, [&f] { return f; });
+    }
+    return last_file_id;
+}
+
+auto EventTrace::new_event(Kind k) -> Event & {
+    if (events.empty()) {
+        events.resize(event_capacity);
+        tokens.resize(token_capacity);
+    }
+    auto &e = events[nb_events++ % event_capacity];
+    e       = {k, 0, file_id(), uint32_t(the_parser.get_cur_line()), 0, 0, 0, 0};
+    return e;
+}
+
+// Expansion of the macro in the given slot of the macro table. Slots are
+// never reused, so that the definition is converted only once.
+void EventTrace::macro(Token t, size_t slot, const Macro &X) {
+    if (slot >= definitions.size()) definitions.resize(slot + 1);
+    if (definitions[slot] == 0) {
+        std::ostringstream o;
+        o << X;
+        definitions[slot] = uint32_t(strings.size());
+        strings.push_back(o.str());
+    }
+    auto &e = new_event(ev_macro);
+    e.a     = t.val;
+    e.b     = definitions[slot];
+}
+
+void EventTrace::argument(size_t i, const TokenList &L) {
+    auto &e = new_event(ev_argument);
+    e.arg   = uint8_t(i);
+    e.first = nb_tokens;
+    e.len   = uint32_t(L.size());
+    for (auto t : L) tokens[nb_tokens++ % token_capacity] = t.val;
+}
+
+void EventTrace::command(CmdChr x) {
+    auto &e = new_event(ev_command);
+    e.a     = x.cmd;
+    e.b     = x.chr;
+}
+
+// Writes the events that are still in the ring. Tokens and commands are
+// converted to strings here, once per distinct value.
+void EventTrace::dump(const std::filesystem::path &p) {
+    std::unordered_map<uint32_t, uint32_t> names, texts;
+    std::unordered_map<uint64_t, uint32_t> commands;
+    std::vector<uint32_t>                  res, spans;
+    auto                                   first_event = nb_events > event_capacity ? nb_events - event_capacity : 0;
+    auto                                   first_token = nb_tokens > token_capacity ? nb_tokens - token_capacity : 0;
+    for (auto k = first_event; k < nb_events; k++) {
+        auto e = events[k % event_capacity];
+        switch (e.kind) {
+        case ev_macro: e.a = intern(names, e.a, strings, [a = e.a] { return Token(a).tok_to_str(); }); break;
+        case ev_command: {
+            CmdChr x(symcodes(e.a), subtypes(e.b));
+            e.a = intern(commands, (uint64_t(e.a) << 32) + e.b, strings, [x] { return command_text(x); });
+            break;
+        }
+        case ev_argument:
+            if (e.first < first_token) {
+                e.len = no_span;
+                break;
+            }
+            for (auto j = e.first; j < e.first + e.len; j++) {
+                auto t = tokens[j % token_capacity];
+                spans.push_back(intern(texts, t, strings, [t] { return list_text(Token(t)); }));
+            }
+            e.first = spans.size() - e.len;
+            break;
+        }
+        res.insert(res.end(), {uint32_t(e.kind) + (uint32_t(e.arg) << 8), e.file, e.line, e.a, e.b, uint32_t(e.first), e.len});
+    }
+
+    std::ofstream fp(p, std::ios::binary);
+    if (!fp) {
+        spdlog::error("Cannot open {} for the event trace", p.string());
+        return;
+    }
+    fp.write(trace_magic, sizeof(trace_magic));
+    fp.write(reinterpret_cast<const char *>(&nb_events), sizeof(nb_events));
+    put_word(fp, uint32_t(strings.size()));
+    for (const auto &s : strings) {
+        put_word(fp, uint32_t(s.size()));
+        fp.write(s.data(), std::streamsize(s.size()));
+    }
+    put_word(fp, uint32_t(res.size() / 7));
+    for (auto x : res) put_word(fp, x);
+    put_word(fp, uint32_t(spans.size()));
+    for (auto x : spans) put_word(fp, x);
+    spdlog::info("Event trace written to {} ({} events, {} lost)", p.string(), nb_events - first_event, first_event);
+}
@@ -1,19 +1,45 @@
 #include "tralics/FpStack.h"
-#include "tralics/FpNum.h"
 #include "tralics/Parser.h"
 
-// upn. Thes stack is a comm-separated list of tokens.
-// This adds L in front.
-void FpStack::push_upn(TokenList &L) {
-    if (!empty()) push_front(hash_table.comma_token);
-    prepend(L);
+namespace {
+    constexpr Digit fp_max = 1000000000; // 10^9
+} // namespace
+
+// upn. The stack is a vector of entries, the top being at the end; each
+// entry holds either a token list or an already computed number.
+// The list L is split at commas, one entry per item; pushing an empty list
+// on an empty stack is a no-op.
+void FpStack::push_tokens(TokenList L) {
+    if (L.empty() && entries.empty()) return;
+    std::vector<TokenList> parts(1);
+    for (auto x : L) {
+        if (x.is_comma_token())
+            parts.emplace_back();
+        else
+            parts.back().push_back(x);
+    }
+    for (auto i = parts.size(); i > 0; i--) entries.push_back({std::move(parts[i - 1]), {}, false});
 }
 
-// This adds a fp number in front of the stack.
+// Removes the top of the stack. If what remains is a single empty list,
+// the list of tokens would be empty (the comma has been read), as the stack.
+void FpStack::pop_entry() {
+    entries.pop_back();
+    if (entries.size() == 1 && !entries[0].is_number && entries[0].tokens.empty()) entries.clear();
+}
+
+// This adds L in front.
+void FpStack::push_upn(TokenList &L) { push_tokens(L); }
+
+// This adds a fp number in front of the stack. Numbers that cannot be
+// read back exactly (after an overflow) are converted to tokens.
 void FpStack::push_upn(const FpNum &x) {
-    if (!empty()) push_front(hash_table.comma_token);
-    TokenList xv = x.to_list();
-    prepend(xv);
+    if (x.data[0] >= fp_max || x.data[1] >= fp_max || x.data[2] >= fp_max || x.data[3] >= fp_max) {
+        push_tokens(x.to_list());
+        return;
+    }
+    entries.push_back({{}, x, true});
+    entries.back().value.correct_sign();
 }
 
 // This takes all tokens from this, until comma or end of list
@@ -23,18 +49,20 @@ void FpStack::pop_upn(TokenList &L) {
         the_parser.parse_error("UPN stack empty");
         return;
     }
-    for (;;) {
-        if (empty()) return;
-        Token x = front();
-        pop_front();
-        if (x.is_comma_token()) return;
-        L.push_back(x);
-    }
+    auto &    e = entries.back();
+    TokenList res = e.is_number ? e.value.to_list() : std::move(e.tokens);
+    L.append(res);
+    pop_entry();
 }
 
 // This takes all tokens from this, until comma or end of list
 // converts them into a FpNumber and puts the result in x.
 void FpStack::pop_upn(FpNum &x) {
+    if (!empty() && entries.back().is_number) {
+        x = the_parser.fp_use_value(entries.back().value);
+        pop_entry();
+        return;
+    }
     x.reset();
     x.sign = true; // Now x is zero
     TokenList L;
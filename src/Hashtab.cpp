@@ -1,13 +1,12 @@
 #include "tralics/Dispatcher.h"
 #include "tralics/Parser.h"
 #include "tralics/Symcode.h"
-#include <utf8.h>
+#include "tralics/Utf8Decoder.h"
 
 namespace {
     auto single_char(const std::string &s) -> std::optional<char32_t> {
-        auto it = s.begin();
-        auto cp = utf8::next(it, s.end());
-        if (it == s.end()) return char32_t(cp);
+        char32_t cp = 0;
+        if (!s.empty() && utf8_ns::decode(s, 0, cp) == s.size()) return cp;
         return {};
     }
 } // namespace
@@ -35,8 +34,14 @@ auto Hashtab::hash_find(const std::string &s) -> size_t {
     static auto &map = the_map();
     if (auto i = map.find(s); i != map.end()) return i->second;
     push_back(s);
-    map.emplace(s, size() - 1);
-    return size() - 1;
+    auto n = size() - 1;
+    map.emplace(s, n);
+    if (auto j = lazy_primitives.find(s); j != lazy_primitives.end()) {
+        the_eqtb()[Token(n + hash_offset).eqtb_loc()] = {j->second, 1};
+        lazy_primitives.erase(j);
+    } else if (lazy_latex3)
+        the_parser.L3_lazy_define(s, Token(n + hash_offset));
+    return n;
 }
 
 // Defines the command named a, but hash_find will not find it.
@@ -54,7 +59,11 @@ auto Hashtab::nohash_primitive(const std::string &a, CmdChr b) -> Token {
 auto Hashtab::is_defined(const std::string &b) -> bool {
     static auto &map = the_map();
     auto         i   = map.find(b);
-    if (i == map.end()) return false;
+    if (i == map.end()) {
+        if (!lazy_primitives.contains(b) && !(lazy_latex3 && Parser::L3_lazy_name(b))) return false;
+        hash_find(b); // defines the command
+        i = map.find(b);
+    }
 
     size_t T = 0;
     if (b.empty())
@@ -65,7 +74,8 @@ auto Hashtab::is_defined(const std::string &b) -> bool {
         T = i->second + hash_offset;
 
     last_tok = Token(T);
-    return !the_eqtb()[Token(T).eqtb_loc()].val.is_undef();
+    auto j   = the_eqtb().find(last_tok.eqtb_loc()); // do not create an entry
+    return j != the_eqtb().end() && !j->second.val.is_undef();
 }
 
 // Creates a primitive.
@@ -75,6 +85,15 @@ auto Hashtab::primitive(const std::string &s, symcodes c, subtypes v) -> Token {
     return res;
 }
 
+// Like primitive, but if the name is not yet in the table, the command is
+// created by hash_find when the name is first seen.
+void Hashtab::lazy_primitive(const std::string &s, symcodes c, subtypes v) {
+    if (the_map().contains(s))
+        primitive(s, c, v);
+    else
+        lazy_primitives.emplace(s, CmdChr(c, v));
+}
+
 auto Hashtab::primitive_plain(const std::string &s, symcodes c, subtypes v) -> Token {
     Symcode::get(c).name_sub[v] = s;
     return primitive(s, c, v);
@@ -1,6 +1,15 @@
 #include "tralics/Parser.h"
 
+namespace {
+    constexpr size_t hash_reserve = 4096; // initial size of the hash table
+} // namespace
+
 Hashtab::Hashtab() {
+    // The bootstrap code defines about 2500 commands, 3500 with latex3;
+    // reserving space avoids rehashing the tables while booting.
+    reserve(hash_reserve);
+    the_map().reserve(hash_reserve);
+    the_eqtb().reserve(hash_reserve);
     frozen_undef_token = nohash_primitive("undefined", CmdChr(undef_cmd, zero_code));
     temp_token         = nohash_primitive("temp", CmdChr(undef_cmd, zero_code));
     endv_token         = nohash_primitive("endv", CmdChr(endv_cmd, zero_code));
@@ -1419,6 +1428,8 @@ void Hashtab::boot_fancyhdr() {
     primitive("inert@thepage", xthepage_cmd);
 }
 
+// The primitives are created when their name is first seen, except for
+// those whose token is needed here; the lets are done at once.
 void Hashtab::boot_latex3() {
     // renaming everything
     eval_let("tex_space:D", " ");
@@ -1883,116 +1894,116 @@ void Hashtab::boot_latex3() {
     locate("q_recursion_stop");
     T3col_tok = locate(":::");
 
-    primitive("GetIdInfo", GetIdInfo_cmd);
-    primitive("GetIdInfoLog", GetIdInfoLog_cmd);
-    primitive("use:c", usename_cmd, zero_code);
+    lazy_primitive("GetIdInfo", GetIdInfo_cmd);
+    lazy_primitive("GetIdInfoLog", GetIdInfoLog_cmd);
+    lazy_primitive("use:c", usename_cmd, zero_code);
     expargsnc_tok = primitive("exp_args:Nc", usename_cmd, one_code);
-    primitive("exp_args:cc", usename_cmd, two_code);
+    lazy_primitive("exp_args:cc", usename_cmd, two_code);
 
-    primitive("cs_meaning:c", convert_cmd, meaning_c_code);
+    lazy_primitive("cs_meaning:c", convert_cmd, meaning_c_code);
     eval_let("token_to_meaning:c", "cs_meaning:c");
-    primitive("cs_set:Npx", def_cmd, ledef_code);
-    primitive("cs_set:Npn", def_cmd, ldef_code);
-    primitive("cs_gset:Npx", def_cmd, lxdef_code);
-    primitive("cs_gset:Npn", def_cmd, lgdef_code);
-    primitive("cs_set_protected_nopar:Npx", def_cmd, pedef_code);
-    primitive("cs_set_protected_nopar:Npn", def_cmd, pdef_code);
-    primitive("cs_set_protected:Npx", def_cmd, pledef_code);
-    primitive("cs_set_protected:Npn", def_cmd, pldef_code);
-    primitive("cs_gset_protected_nopar:Npx", def_cmd, pxdef_code);
-    primitive("cs_gset_protected_nopar:Npn", def_cmd, pgdef_code);
-    primitive("cs_gset_protected:Npx", def_cmd, plxdef_code);
-    primitive("cs_gset_protected:Npn", def_cmd, plgdef_code);
-    primitive("cs_new_nopar:Npn", def_cmd, gdefn_code);
-    primitive("cs_new_nopar:Npx", def_cmd, xdefn_code);
-    primitive("cs_new:Npn", def_cmd, lgdefn_code);
-    primitive("cs_new:Npx", def_cmd, lxdefn_code);
-    primitive("cs_new_protected_nopar:Npn", def_cmd, pgdefn_code);
-    primitive("cs_new_protected_nopar:Npx", def_cmd, pxdefn_code);
-    primitive("cs_new_protected:Npn", def_cmd, plgdefn_code);
-    primitive("cs_new_protected:Npx", def_cmd, plxdefn_code);
+    lazy_primitive("cs_set:Npx", def_cmd, ledef_code);
+    lazy_primitive("cs_set:Npn", def_cmd, ldef_code);
+    lazy_primitive("cs_gset:Npx", def_cmd, lxdef_code);
+    lazy_primitive("cs_gset:Npn", def_cmd, lgdef_code);
+    lazy_primitive("cs_set_protected_nopar:Npx", def_cmd, pedef_code);
+    lazy_primitive("cs_set_protected_nopar:Npn", def_cmd, pdef_code);
+    lazy_primitive("cs_set_protected:Npx", def_cmd, pledef_code);
+    lazy_primitive("cs_set_protected:Npn", def_cmd, pldef_code);
+    lazy_primitive("cs_gset_protected_nopar:Npx", def_cmd, pxdef_code);
+    lazy_primitive("cs_gset_protected_nopar:Npn", def_cmd, pgdef_code);
+    lazy_primitive("cs_gset_protected:Npx", def_cmd, plxdef_code);
+    lazy_primitive("cs_gset_protected:Npn", def_cmd, plgdef_code);
+    lazy_primitive("cs_new_nopar:Npn", def_cmd, gdefn_code);
+    lazy_primitive("cs_new_nopar:Npx", def_cmd, xdefn_code);
+    lazy_primitive("cs_new:Npn", def_cmd, lgdefn_code);
+    lazy_primitive("cs_new:Npx", def_cmd, lxdefn_code);
+    lazy_primitive("cs_new_protected_nopar:Npn", def_cmd, pgdefn_code);
+    lazy_primitive("cs_new_protected_nopar:Npx", def_cmd, pxdefn_code);
+    lazy_primitive("cs_new_protected:Npn", def_cmd, plgdefn_code);
+    lazy_primitive("cs_new_protected:Npx", def_cmd, plxdefn_code);
 
-    primitive("cs_set_nopar:cpn", def_cmd, cdef_code);
-    primitive("cs_set_nopar:cpx", def_cmd, cedef_code);
-    primitive("cs_gset_nopar:cpn", def_cmd, cgdef_code);
-    primitive("cs_gset_nopar:cpx", def_cmd, cxdef_code);
-    primitive("cs_new_nopar:cpn", def_cmd, cgdefn_code);
-    primitive("cs_new_nopar:cpx", def_cmd, cxdefn_code);
-    primitive("cs_set:cpn", def_cmd, cldef_code);
-    primitive("cs_set:cpx", def_cmd, cledef_code);
-    primitive("cs_gset:cpn", def_cmd, clgdef_code);
-    primitive("cs_gset:cpx", def_cmd, clxdef_code);
-    primitive("cs_new:cpn", def_cmd, clgdefn_code);
-    primitive("cs_new:cpx", def_cmd, clxdefn_code);
-    primitive("cs_set_protected_nopar:cpn", def_cmd, cpdef_code);
-    primitive("cs_set_protected_nopar:cpx", def_cmd, cpedef_code);
-    primitive("cs_gset_protected_nopar:cpn", def_cmd, cpgdef_code);
-    primitive("cs_gset_protected_nopar:cpx", def_cmd, cpxdef_code);
-    primitive("cs_new_protected_nopar:cpn", def_cmd, cpgdefn_code);
-    primitive("cs_new_protected_nopar:cpx", def_cmd, cpxdefn_code);
-    primitive("cs_set_protected:cpn", def_cmd, cpldef_code);
-    primitive("cs_set_protected:cpx", def_cmd, cpledef_code);
-    primitive("cs_gset_protected:cpn", def_cmd, cplgdef_code);
-    primitive("cs_gset_protected:cpx", def_cmd, cplxdef_code);
-    primitive("cs_new_protected:cpn", def_cmd, cplgdefn_code);
-    primitive("cs_new_protected:cpx", def_cmd, cplxdefn_code);
+    lazy_primitive("cs_set_nopar:cpn", def_cmd, cdef_code);
+    lazy_primitive("cs_set_nopar:cpx", def_cmd, cedef_code);
+    lazy_primitive("cs_gset_nopar:cpn", def_cmd, cgdef_code);
+    lazy_primitive("cs_gset_nopar:cpx", def_cmd, cxdef_code);
+    lazy_primitive("cs_new_nopar:cpn", def_cmd, cgdefn_code);
+    lazy_primitive("cs_new_nopar:cpx", def_cmd, cxdefn_code);
+    lazy_primitive("cs_set:cpn", def_cmd, cldef_code);
+    lazy_primitive("cs_set:cpx", def_cmd, cledef_code);
+    lazy_primitive("cs_gset:cpn", def_cmd, clgdef_code);
+    lazy_primitive("cs_gset:cpx", def_cmd, clxdef_code);
+    lazy_primitive("cs_new:cpn", def_cmd, clgdefn_code);
+    lazy_primitive("cs_new:cpx", def_cmd, clxdefn_code);
+    lazy_primitive("cs_set_protected_nopar:cpn", def_cmd, cpdef_code);
+    lazy_primitive("cs_set_protected_nopar:cpx", def_cmd, cpedef_code);
+    lazy_primitive("cs_gset_protected_nopar:cpn", def_cmd, cpgdef_code);
+    lazy_primitive("cs_gset_protected_nopar:cpx", def_cmd, cpxdef_code);
+    lazy_primitive("cs_new_protected_nopar:cpn", def_cmd, cpgdefn_code);
+    lazy_primitive("cs_new_protected_nopar:cpx", def_cmd, cpxdefn_code);
+    lazy_primitive("cs_set_protected:cpn", def_cmd, cpldef_code);
+    lazy_primitive("cs_set_protected:cpx", def_cmd, cpledef_code);
+    lazy_primitive("cs_gset_protected:cpn", def_cmd, cplgdef_code);
+    lazy_primitive("cs_gset_protected:cpx", def_cmd, cplxdef_code);
+    lazy_primitive("cs_new_protected:cpn", def_cmd, cplgdefn_code);
+    lazy_primitive("cs_new_protected:cpx", def_cmd, cplxdefn_code);
 
     T_usen = primitive("use:n", all_of_one_cmd, one_code);
-    primitive("use:nn", all_of_one_cmd, two_code);
-    primitive("use:nnn", all_of_one_cmd, three_code);
-    primitive("use:nnnn", all_of_one_cmd, four_code);
-    primitive("use_i_ii:nnn", all_of_one_cmd, subtypes(5));
-    primitive("use_i:nnn", first_of_three_cmd, one_code);
-    primitive("use_ii:nnn", first_of_three_cmd, two_code);
-    primitive("use_iii:nnn", first_of_three_cmd, three_code);
-    primitive("use_i:nnnn", first_of_four_cmd, one_code);
-    primitive("use_ii:nnnn", first_of_four_cmd, two_code);
-    primitive("use_iii:nnnn", first_of_four_cmd, three_code);
-    primitive("use_iv:nnnn", first_of_four_cmd, four_code);
+    lazy_primitive("use:nn", all_of_one_cmd, two_code);
+    lazy_primitive("use:nnn", all_of_one_cmd, three_code);
+    lazy_primitive("use:nnnn", all_of_one_cmd, four_code);
+    lazy_primitive("use_i_ii:nnn", all_of_one_cmd, subtypes(5));
+    lazy_primitive("use_i:nnn", first_of_three_cmd, one_code);
+    lazy_primitive("use_ii:nnn", first_of_three_cmd, two_code);
+    lazy_primitive("use_iii:nnn", first_of_three_cmd, three_code);
+    lazy_primitive("use_i:nnnn", first_of_four_cmd, one_code);
+    lazy_primitive("use_ii:nnnn", first_of_four_cmd, two_code);
+    lazy_primitive("use_iii:nnnn", first_of_four_cmd, three_code);
+    lazy_primitive("use_iv:nnnn", first_of_four_cmd, four_code);
     T_use_nonen = primitive("use_none:n", ignore_n_args_cmd, one_code);
-    primitive("use_none:nn", ignore_n_args_cmd, two_code);
-    primitive("use_none:nnn", ignore_n_args_cmd, three_code);
-    primitive("use_none:nnnn", ignore_n_args_cmd, four_code);
-    primitive("use_none:nnnnn", ignore_n_args_cmd, subtypes(5));
-    primitive("use_none:nnnnnn", ignore_n_args_cmd, subtypes(6));
-    primitive("use_none:nnnnnnn", ignore_n_args_cmd, subtypes(7));
-    primitive("use_none:nnnnnnnn", ignore_n_args_cmd, subtypes(8));
-    primitive("use_none:nnnnnnnnn", ignore_n_args_cmd, subtypes(9));
-    primitive("prg_return_true:", prg_return_cmd, zero_code);
-    primitive("prg_return_false:", prg_return_cmd, one_code);
-    primitive("prg_set_conditional:Npnn", l3_gen_cond_Npnn_cmd, L3_set_code);
-    primitive("prg_new_conditional:Npnn", l3_gen_cond_Npnn_cmd, L3_new_code);
-    primitive("prg_set_protected_conditional:Npnn", l3_gen_cond_Npnn_cmd, L3_setp_code);
-    primitive("prg_new_protected_conditional:Npnn", l3_gen_cond_Npnn_cmd, L3_newp_code);
-    primitive("prg_set_conditional:Nnn", l3_gen_cond_Nnn_cmd, L3_set_code);
-    primitive("prg_new_conditional:Nnn", l3_gen_cond_Nnn_cmd, L3_new_code);
-    primitive("prg_set_protected_conditional:Nnn", l3_gen_cond_Nnn_cmd, L3_setp_code);
-    primitive("prg_new_protected_conditional:Nnn", l3_gen_cond_Nnn_cmd, L3_newp_code);
-    primitive("prg_set_eq_conditional:NNn", l3_gen_eq_cond_cmd, L3_set_code);
-    primitive("prg_new_eq_conditional:NNn", l3_gen_eq_cond_cmd, L3_new_code);
-    primitive("cs_to_str:N", convert_cmd, l3string_code);
-    primitive("__cs_get_function_name:N", splitfun_cmd, zero_code);
-    primitive("__cs_get_function_signature:N", splitfun_cmd, one_code);
-    primitive("iow_term:x", extension_cmd, write_term_code);
-    primitive("iow_log:x", extension_cmd, write_log_code);
-    primitive("__chk_if_free_cs:N", l3_check_cmd, zero_code);
-    primitive("__chk_if_free_cs:c", l3_check_cmd, one_code);
-    primitive("__chk_if_exist_cs:N", l3_check_cmd, two_code);
-    primitive("__chk_if_exist_cs:c", l3_check_cmd, three_code);
-    primitive("cs_set_eq:NN", let_cmd, letNN_code);
-    primitive("cs_set_eq:cN", let_cmd, letcN_code);
-    primitive("cs_set_eq:Nc", let_cmd, letNc_code);
-    primitive("cs_set_eq:cc", let_cmd, letcc_code);
-    primitive("cs_gset_eq:NN", let_cmd, gletNN_code);
-    primitive("cs_gset_eq:cN", let_cmd, gletcN_code);
-    primitive("cs_gset_eq:Nc", let_cmd, gletNc_code);
-    primitive("cs_gset_eq:cc", let_cmd, gletcc_code);
-    primitive("cs_new_eq:NN", let_cmd, nletNN_code);
-    primitive("cs_new_eq:cN", let_cmd, nletcN_code);
-    primitive("cs_new_eq:Nc", let_cmd, nletNc_code);
-    primitive("cs_new_eq:cc", let_cmd, nletcc_code);
-    primitive("cs_undefine:N", let_cmd, undef_code);
-    primitive("cs_undefine:c", let_cmd, undefc_code);
+    lazy_primitive("use_none:nn", ignore_n_args_cmd, two_code);
+    lazy_primitive("use_none:nnn", ignore_n_args_cmd, three_code);
+    lazy_primitive("use_none:nnnn", ignore_n_args_cmd, four_code);
+    lazy_primitive("use_none:nnnnn", ignore_n_args_cmd, subtypes(5));
+    lazy_primitive("use_none:nnnnnn", ignore_n_args_cmd, subtypes(6));
+    lazy_primitive("use_none:nnnnnnn", ignore_n_args_cmd, subtypes(7));
+    lazy_primitive("use_none:nnnnnnnn", ignore_n_args_cmd, subtypes(8));
+    lazy_primitive("use_none:nnnnnnnnn", ignore_n_args_cmd, subtypes(9));
+    lazy_primitive("prg_return_true:", prg_return_cmd, zero_code);
+    lazy_primitive("prg_return_false:", prg_return_cmd, one_code);
+    lazy_primitive("prg_set_conditional:Npnn", l3_gen_cond_Npnn_cmd, L3_set_code);
+    lazy_primitive("prg_new_conditional:Npnn", l3_gen_cond_Npnn_cmd, L3_new_code);
+    lazy_primitive("prg_set_protected_conditional:Npnn", l3_gen_cond_Npnn_cmd, L3_setp_code);
+    lazy_primitive("prg_new_protected_conditional:Npnn", l3_gen_cond_Npnn_cmd, L3_newp_code);
+    lazy_primitive("prg_set_conditional:Nnn", l3_gen_cond_Nnn_cmd, L3_set_code);
+    lazy_primitive("prg_new_conditional:Nnn", l3_gen_cond_Nnn_cmd, L3_new_code);
+    lazy_primitive("prg_set_protected_conditional:Nnn", l3_gen_cond_Nnn_cmd, L3_setp_code);
+    lazy_primitive("prg_new_protected_conditional:Nnn", l3_gen_cond_Nnn_cmd, L3_newp_code);
+    lazy_primitive("prg_set_eq_conditional:NNn", l3_gen_eq_cond_cmd, L3_set_code);
+    lazy_primitive("prg_new_eq_conditional:NNn", l3_gen_eq_cond_cmd, L3_new_code);
+    lazy_primitive("cs_to_str:N", convert_cmd, l3string_code);
+    lazy_primitive("__cs_get_function_name:N", splitfun_cmd, zero_code);
+    lazy_primitive("__cs_get_function_signature:N", splitfun_cmd, one_code);
+    lazy_primitive("iow_term:x", extension_cmd, write_term_code);
+    lazy_primitive("iow_log:x", extension_cmd, write_log_code);
+    lazy_primitive("__chk_if_free_cs:N", l3_check_cmd, zero_code);
+    lazy_primitive("__chk_if_free_cs:c", l3_check_cmd, one_code);
+    lazy_primitive("__chk_if_exist_cs:N", l3_check_cmd, two_code);
+    lazy_primitive("__chk_if_exist_cs:c", l3_check_cmd, three_code);
+    lazy_primitive("cs_set_eq:NN", let_cmd, letNN_code);
+    lazy_primitive("cs_set_eq:cN", let_cmd, letcN_code);
+    lazy_primitive("cs_set_eq:Nc", let_cmd, letNc_code);
+    lazy_primitive("cs_set_eq:cc", let_cmd, letcc_code);
+    lazy_primitive("cs_gset_eq:NN", let_cmd, gletNN_code);
+    lazy_primitive("cs_gset_eq:cN", let_cmd, gletcN_code);
+    lazy_primitive("cs_gset_eq:Nc", let_cmd, gletNc_code);
+    lazy_primitive("cs_gset_eq:cc", let_cmd, gletcc_code);
+    lazy_primitive("cs_new_eq:NN", let_cmd, nletNN_code);
+    lazy_primitive("cs_new_eq:cN", let_cmd, nletcN_code);
+    lazy_primitive("cs_new_eq:Nc", let_cmd, nletNc_code);
+    lazy_primitive("cs_new_eq:cc", let_cmd, nletcc_code);
+    lazy_primitive("cs_undefine:N", let_cmd, undef_code);
+    lazy_primitive("cs_undefine:c", let_cmd, undefc_code);
     eval_let("tl_set_eq:NN", "cs_set_eq:NN");
     eval_let("tl_set_eq:cN", "cs_set_eq:cN");
     eval_let("tl_set_eq:Nc", "cs_set_eq:Nc");
@@ -2002,8 +2013,8 @@ void Hashtab::boot_latex3() {
     eval_let("tl_gset_eq:Nc", "cs_gset_eq:Nc");
     eval_let("tl_gset_eq:cc", "cs_gset_eq:cc");
 
-    primitive("__kernel_register_show:N", xray_cmd, register_show_code);
-    primitive("__kernel_register_show:c", xray_cmd, registerc_show_code);
+    lazy_primitive("__kernel_register_show:N", xray_cmd, register_show_code);
+    lazy_primitive("__kernel_register_show:c", xray_cmd, registerc_show_code);
     eval_let("int_show:N", "__kernel_register_show:N");
     eval_let("int_show:c", "__kernel_register_show:c");
     eval_let("dim_show:N", "__kernel_register_show:N");
@@ -2012,410 +2023,410 @@ void Hashtab::boot_latex3() {
     eval_let("skip_show:c", "__kernel_register_show:c");
     eval_let("muskip_show:N", "__kernel_register_show:N");
     eval_let("muskip_show:c", "__kernel_register_show:c");
-    primitive("cs_generate_variant:Nn", l3_generate_variant_cmd);
+    lazy_primitive("cs_generate_variant:Nn", l3_generate_variant_cmd);
     gen_from_sig_tok = primitive("__cs_generate_from_signature:NNn", l3_gen_from_sig_cmd);
-    primitive("cs_generate_from_arg_count:NNnn", l3_gen_from_ac_cmd, zero_code);
-    primitive("cs_generate_from_arg_count:cNnn", l3_gen_from_ac_cmd, one_code);
-    primitive("cs_generate_from_arg_count:Ncnn", l3_gen_from_ac_cmd, two_code);
-    primitive("::n", l3expand_aux_cmd, l3expn_code);
-    primitive("::N", l3expand_aux_cmd, l3expN_code);
-    primitive("::p", l3expand_aux_cmd, l3expp_code);
-    primitive("::c", l3expand_aux_cmd, l3expc_code);
-    primitive("::o", l3expand_aux_cmd, l3expo_code);
-    primitive("::f", l3expand_aux_cmd, l3expf_code);
-    primitive("::x", l3expand_aux_cmd, l3expx_code);
-    primitive("::V", l3expand_aux_cmd, l3expV_code);
-    primitive("::v", l3expand_aux_cmd, l3expv_code);
-    primitive("::f_unbraced", l3expand_aux_cmd, l3expfu_code);
-    primitive("::o_unbraced", l3expand_aux_cmd, l3expou_code);
-    primitive("::v_unbraced", l3expand_aux_cmd, l3expvu_code);
-    primitive("::V_unbraced", l3expand_aux_cmd, l3expVu_code);
-    primitive("::x_unbraced", l3expand_aux_cmd, l3expxu_code);
-    primitive("exp_not:c", l3noexpand_cmd, l3expc_code);
-    primitive("exp_not:f", l3noexpand_cmd, l3expf_code);
-    primitive("exp_not:o", l3noexpand_cmd, l3expo_code);
-    primitive("exp_not:v", l3noexpand_cmd, l3expv_code);
-    primitive("exp_not:V", l3noexpand_cmd, l3expV_code);
-    primitive("exp_args:No", l3expand_base_cmd, l3exp_No_code);
-    primitive("exp_args:NNo", l3expand_base_cmd, l3exp_NNo_code);
-    primitive("exp_args:NNNo", l3expand_base_cmd, l3exp_NNNo_code);
-    primitive("exp_args:NNc", l3expand_base_cmd, l3exp_NNc_code);
-    primitive("exp_args:Ncc", l3expand_base_cmd, l3exp_Ncc_code);
-    primitive("exp_args:Nccc", l3expand_base_cmd, l3exp_Nccc_code);
-    primitive("exp_args:Nf", l3expand_base_cmd, l3exp_Nf_code);
-    primitive("exp_args:NNf", l3expand_base_cmd, l3exp_NNf_code);
-    primitive("exp_args:Nv", l3expand_base_cmd, l3exp_Nv_code);
-    primitive("exp_args:NNv", l3expand_base_cmd, l3exp_NNv_code);
-    primitive("exp_args:NV", l3expand_base_cmd, l3exp_NV_code);
-    primitive("exp_args:NNV", l3expand_base_cmd, l3exp_NNV_code);
-    primitive("exp_args:NNNV", l3expand_base_cmd, l3exp_NNNV_code);
-    primitive("exp_args:Nco", l3expand_base_cmd, l3exp_Nco_code);
-    primitive("exp_args:Ncf", l3expand_base_cmd, l3exp_Ncf_code);
-    primitive("exp_args:NVV", l3expand_base_cmd, l3exp_NVV_code);
-    primitive("exp_args:NcNc", l3expand_base_cmd, l3exp_NcNc_code);
-    primitive("exp_args:Ncco", l3expand_base_cmd, l3exp_Ncco_code);
-    primitive("exp_args:Nx", l3expand_base_cmd, l3exp_Nx_code);
-    primitive("exp_args:Nnc", l3expand_base_cmd, l3exp_Nnc_code);
-    primitive("exp_args:Nfo", l3expand_base_cmd, l3exp_Nfo_code);
-    primitive("exp_args:Nff", l3expand_base_cmd, l3exp_Nff_code);
-    primitive("exp_args:Nnf", l3expand_base_cmd, l3exp_Nnf_code);
-    primitive("exp_args:Nno", l3expand_base_cmd, l3exp_Nno_code);
-    primitive("exp_args:NnV", l3expand_base_cmd, l3exp_NnV_code);
-    primitive("exp_args:Noo", l3expand_base_cmd, l3exp_Noo_code);
-    primitive("exp_args:Nof", l3expand_base_cmd, l3exp_Nof_code);
-    primitive("exp_args:Noc", l3expand_base_cmd, l3exp_Noc_code);
-    primitive("exp_args:NNx", l3expand_base_cmd, l3exp_NNx_code);
-    primitive("exp_args:Ncx", l3expand_base_cmd, l3exp_Ncx_code);
-    primitive("exp_args:Nnx", l3expand_base_cmd, l3exp_Nnx_code);
-    primitive("exp_args:Nox", l3expand_base_cmd, l3exp_Nox_code);
-    primitive("exp_args:Nxo", l3expand_base_cmd, l3exp_Nxo_code);
-    primitive("exp_args:Nxx", l3expand_base_cmd, l3exp_Nxx_code);
-    primitive("exp_args:NNno", l3expand_base_cmd, l3exp_NNno_code);
-    primitive("exp_args:NNoo", l3expand_base_cmd, l3exp_NNoo_code);
-    primitive("exp_args:Nnnc", l3expand_base_cmd, l3exp_Nnnc_code);
-    primitive("exp_args:Nnno", l3expand_base_cmd, l3exp_Nnno_code);
-    primitive("exp_args:Nooo", l3expand_base_cmd, l3exp_Nooo_code);
-    primitive("exp_args:NNnx", l3expand_base_cmd, l3exp_NNnx_code);
-    primitive("exp_args:NNox", l3expand_base_cmd, l3exp_NNox_code);
-    primitive("exp_args:Nnnx", l3expand_base_cmd, l3exp_Nnnx_code);
-    primitive("exp_args:Nnox", l3expand_base_cmd, l3exp_Nnox_code);
-    primitive("exp_args:Nccx", l3expand_base_cmd, l3exp_Nccx_code);
-    primitive("exp_args:Ncnx", l3expand_base_cmd, l3exp_Ncnx_code);
-    primitive("exp_args:Noox", l3expand_base_cmd, l3exp_Noox_code);
-    primitive("exp_last_unbraced:NV", l3expand_base_cmd, l3exp_NVu_code);
-    primitive("exp_last_unbraced:Nv", l3expand_base_cmd, l3exp_Nvu_code);
-    primitive("exp_last_unbraced:No", l3expand_base_cmd, l3exp_Nou_code);
-    primitive("exp_last_unbraced:Nf", l3expand_base_cmd, l3exp_Nfu_code);
-    primitive("exp_last_unbraced:Nco", l3expand_base_cmd, l3exp_Ncou_code);
-    primitive("exp_last_unbraced:NcV", l3expand_base_cmd, l3exp_NcVu_code);
-    primitive("exp_last_unbraced:NNV", l3expand_base_cmd, l3exp_NNVu_code);
-    primitive("exp_last_unbraced:NNo", l3expand_base_cmd, l3exp_NNou_code);
-    primitive("exp_last_unbraced:NNNV", l3expand_base_cmd, l3exp_NNNVu_code);
-    primitive("exp_last_unbraced:NNNo", l3expand_base_cmd, l3exp_NNNou_code);
-    primitive("exp_last_unbraced:Nno", l3expand_base_cmd, l3exp_Nnou_code);
-    primitive("exp_last_unbraced:Noo", l3expand_base_cmd, l3exp_Noou_code);
-    primitive("exp_last_unbraced:Nfo", l3expand_base_cmd, l3exp_Nfou_code);
-    primitive("exp_last_unbraced:NnNo", l3expand_base_cmd, l3exp_NnNou_code);
-    primitive("exp_last_unbraced:Nx", l3expand_base_cmd, l3exp_Nxu_code);
-    primitive("exp_last_two_unbraced:Noo", l3expand_base_cmd, l3exp_Nouou_code);
-    primitive("cs_if_eq_p:NN", l3_ifx_cmd, l3_p_NN_code);
-    primitive("cs_if_eq:NNTF", l3_ifx_cmd, l3_TF_NN_code);
-    primitive("cs_if_eq:NNT", l3_ifx_cmd, l3_T_NN_code);
-    primitive("cs_if_eq:NNF", l3_ifx_cmd, l3_F_NN_code);
-    primitive("cs_if_eq_p:Nc", l3_ifx_cmd, l3_p_Nc_code);
-    primitive("cs_if_eq:NcTF", l3_ifx_cmd, l3_TF_Nc_code);
-    primitive("cs_if_eq:NcT", l3_ifx_cmd, l3_T_Nc_code);
-    primitive("cs_if_eq:NcF", l3_ifx_cmd, l3_F_Nc_code);
-    primitive("cs_if_eq_p:cN", l3_ifx_cmd, l3_p_cN_code);
-    primitive("cs_if_eq:cNTF", l3_ifx_cmd, l3_TF_cN_code);
-    primitive("cs_if_eq:cNT", l3_ifx_cmd, l3_T_cN_code);
-    primitive("cs_if_eq:cNF", l3_ifx_cmd, l3_F_cN_code);
-    primitive("cs_if_eq_p:cc", l3_ifx_cmd, l3_p_cc_code);
-    primitive("cs_if_eq:ccTF", l3_ifx_cmd, l3_TF_cc_code);
-    primitive("cs_if_eq:ccT", l3_ifx_cmd, l3_T_cc_code);
-    primitive("cs_if_eq:ccF", l3_ifx_cmd, l3_F_cc_code);
-    primitive("str_if_eq_p:nn", l3str_ifeq_cmd, l3_p_code);
-    primitive("str_if_eq:nnTF", l3str_ifeq_cmd, l3_TF_code);
-    primitive("str_if_eq:nnT", l3str_ifeq_cmd, l3_T_code);
-    primitive("str_if_eq:nnF", l3str_ifeq_cmd, l3_F_code);
-    primitive("str_if_eq_x_p:nn", l3str_ifeq_cmd, subtypes(l3_p_code + 4));
-    primitive("str_if_eq_x:nnTF", l3str_ifeq_cmd, subtypes(l3_TF_code + 4));
-    primitive("str_if_eq_x:nnT", l3str_ifeq_cmd, subtypes(l3_T_code + 4));
-    primitive("str_if_eq_x:nnF", l3str_ifeq_cmd, subtypes(l3_F_code + 4));
-    primitive("str_if_eq_p:Vn", l3str_ifeq_cmd, subtypes(l3_p_code + 8));
-    primitive("str_if_eq:VnTF", l3str_ifeq_cmd, subtypes(l3_TF_code + 8));
-    primitive("str_if_eq:VnT", l3str_ifeq_cmd, subtypes(l3_T_code + 8));
-    primitive("str_if_eq:VnF", l3str_ifeq_cmd, subtypes(l3_F_code + 8));
-    primitive("str_if_eq_p:on", l3str_ifeq_cmd, subtypes(l3_p_code + 12));
-    primitive("str_if_eq:onTF", l3str_ifeq_cmd, subtypes(l3_TF_code + 12));
-    primitive("str_if_eq:onT", l3str_ifeq_cmd, subtypes(l3_T_code + 12));
-    primitive("str_if_eq:onF", l3str_ifeq_cmd, subtypes(l3_F_code + 12));
-    primitive("str_if_eq_p:no", l3str_ifeq_cmd, subtypes(l3_p_code + 16));
-    primitive("str_if_eq:noTF", l3str_ifeq_cmd, subtypes(l3_TF_code + 16));
-    primitive("str_if_eq:noT", l3str_ifeq_cmd, subtypes(l3_T_code + 16));
-    primitive("str_if_eq:noF", l3str_ifeq_cmd, subtypes(l3_F_code + 16));
-    primitive("str_if_eq_p:nV", l3str_ifeq_cmd, subtypes(l3_p_code + 20));
-    primitive("str_if_eq:nVTF", l3str_ifeq_cmd, subtypes(l3_TF_code + 20));
-    primitive("str_if_eq:nVT", l3str_ifeq_cmd, subtypes(l3_T_code + 20));
-    primitive("str_if_eq:nVF", l3str_ifeq_cmd, subtypes(l3_F_code + 20));
-    primitive("str_if_eq_p:VV", l3str_ifeq_cmd, subtypes(l3_p_code + 24));
-    primitive("str_if_eq:VVTF", l3str_ifeq_cmd, subtypes(l3_TF_code + 24));
-    primitive("str_if_eq:VVT", l3str_ifeq_cmd, subtypes(l3_T_code + 24));
-    primitive("str_if_eq:VVF", l3str_ifeq_cmd, subtypes(l3_F_code + 24));
-    primitive("str_case:nn", l3str_case_cmd, l3_p_code);
-    primitive("str_case:nnTF", l3str_case_cmd, l3_TF_code);
-    primitive("str_case:nnT", l3str_case_cmd, l3_T_code);
-    primitive("str_case:nnF", l3str_case_cmd, l3_F_code);
-    primitive("str_case:nnn", l3str_case_cmd, l3_F_code);
-    primitive("str_case_x:nn", l3str_case_cmd, subtypes(l3_p_code + 4));
-    primitive("str_case_x:nnTF", l3str_case_cmd, subtypes(l3_TF_code + 4));
-    primitive("str_case_x:nnT", l3str_case_cmd, subtypes(l3_T_code + 4));
-    primitive("str_case_x:nnF", l3str_case_cmd, subtypes(l3_F_code + 4));
-    primitive("str_case_x:nnn", l3str_case_cmd, subtypes(l3_F_code + 4));
-    primitive("str_case:on", l3str_case_cmd, subtypes(l3_p_code + 8));
-    primitive("str_case:onTF", l3str_case_cmd, subtypes(l3_TF_code + 8));
-    primitive("str_case:onT", l3str_case_cmd, subtypes(l3_T_code + 8));
-    primitive("str_case:onF", l3str_case_cmd, subtypes(l3_F_code + 8));
-    primitive("str_case:onn", l3str_case_cmd, subtypes(l3_F_code + 8));
-    primitive("char_set_catcode_escape:n", l3_set_cat_cmd, subtypes(escape_catcode));
-    primitive("char_set_catcode_group_begin:n", l3_set_cat_cmd, subtypes(open_catcode));
-    primitive("char_set_catcode_group_end:n", l3_set_cat_cmd, subtypes(close_catcode));
-    primitive("char_set_catcode_math_toggle:n", l3_set_cat_cmd, subtypes(dollar_catcode));
-    primitive("char_set_catcode_alignment:n", l3_set_cat_cmd, subtypes(alignment_catcode));
-    primitive("char_set_catcode_end_line:n", l3_set_cat_cmd, subtypes(eol_catcode));
-    primitive("char_set_catcode_parameter:n", l3_set_cat_cmd, subtypes(parameter_catcode));
-    primitive("char_set_catcode_math_superscript:n", l3_set_cat_cmd, subtypes(hat_catcode));
-    primitive("char_set_catcode_math_subscript:n", l3_set_cat_cmd, subtypes(underscore_catcode));
-    primitive("char_set_catcode_ignore:n", l3_set_cat_cmd, subtypes(ignored_catcode));
-    primitive("char_set_catcode_space:n", l3_set_cat_cmd, subtypes(space_catcode));
-    primitive("char_set_catcode_letter:n", l3_set_cat_cmd, subtypes(letter_catcode));
-    primitive("char_set_catcode_other:n", l3_set_cat_cmd, subtypes(other_catcode));
-    primitive("char_set_catcode_active:n", l3_set_cat_cmd, subtypes(active_catcode));
-    primitive("char_set_catcode_invalid:n", l3_set_cat_cmd, subtypes(invalid_catcode));
-    primitive("char_set_catcode_comment:n", l3_set_cat_cmd, subtypes(comment_catcode));
-    primitive("char_set_catcode_escape:N", l3_set_cat_cmd, subtypes(escape_catcode + 16));
-    primitive("char_set_catcode_group_begin:N", l3_set_cat_cmd, subtypes(open_catcode + 16));
-    primitive("char_set_catcode_group_end:N", l3_set_cat_cmd, subtypes(close_catcode + 16));
-    primitive("char_set_catcode_math_toggle:N", l3_set_cat_cmd, subtypes(dollar_catcode + 16));
-    primitive("char_set_catcode_alignment:N", l3_set_cat_cmd, subtypes(alignment_catcode + 16));
-    primitive("char_set_catcode_end_line:N", l3_set_cat_cmd, subtypes(eol_catcode + 16));
-    primitive("char_set_catcode_parameter:N", l3_set_cat_cmd, subtypes(parameter_catcode + 16));
-    primitive("char_set_catcode_math_superscript:N", l3_set_cat_cmd, subtypes(hat_catcode + 16));
-    primitive("char_set_catcode_math_subscript:N", l3_set_cat_cmd, subtypes(underscore_catcode + 16));
-    primitive("char_set_catcode_ignore:N", l3_set_cat_cmd, subtypes(ignored_catcode + 16));
-    primitive("char_set_catcode_space:N", l3_set_cat_cmd, subtypes(space_catcode + 16));
-    primitive("char_set_catcode_letter:N", l3_set_cat_cmd, subtypes(letter_catcode + 16));
-    primitive("char_set_catcode_other:N", l3_set_cat_cmd, subtypes(other_catcode + 16));
-    primitive("char_set_catcode_active:N", l3_set_cat_cmd, subtypes(active_catcode + 16));
-    primitive("char_set_catcode_invalid:N", l3_set_cat_cmd, subtypes(invalid_catcode + 16));
-    primitive("char_set_catcode_comment:N", l3_set_cat_cmd, subtypes(comment_catcode + 16));
-    primitive("char_set_catcode:nn", l3_set_num_cmd, setcat_code);
-    primitive("char_value_catcode:n", l3E_set_num_cmd, thecat_code);
-    primitive("char_show_value_catcode:n", l3_set_num_cmd, showcat_code);
-    primitive("char_set_mathcode:nn", l3_set_num_cmd, setmath_code);
-    primitive("char_value_mathcode:n", l3E_set_num_cmd, themath_code);
-    primitive("char_show_value_mathcode:n", l3_set_num_cmd, showmath_code);
-    primitive("char_set_lccode:nn", l3_set_num_cmd, setlc_code);
-    primitive("char_value_lccode:n", l3E_set_num_cmd, thelc_code);
-    primitive("char_show_value_lccode:n", l3_set_num_cmd, showlc_code);
-    primitive("char_set_uccode:nn", l3_set_num_cmd, setuc_code);
-    primitive("char_value_uccode:n", l3E_set_num_cmd, theuc_code);
-    primitive("char_show_value_uccode:n", l3_set_num_cmd, showuc_code);
-    primitive("char_set_sfcode:nn", l3_set_num_cmd, setsf_code);
-    primitive("char_value_sfcode:n", l3E_set_num_cmd, thesf_code);
-    primitive("char_show_value_sfcode:n", l3_set_num_cmd, showsf_code);
-    primitive("c_group_begin_token", open_catcode, subtypes('{'));
-    primitive("c_group_end_token", close_catcode, subtypes('}'));
-    primitive("c_math_toggle_token", dollar_catcode, subtypes('*'));
-    primitive("c_alignment_token", alignment_catcode, subtypes('*'));
-    primitive("c_parameter_token", parameter_catcode, subtypes('#'));
-    primitive("c_math_superscript_token", hat_catcode, subtypes('^'));
-    primitive("c_math_subscript_token", underscore_catcode, subtypes('*'));
-    primitive("c_space_token", space_catcode, subtypes('~'));
-    primitive("c_catcode_letter_token", letter_catcode, subtypes('a'));
-    primitive("c_catcode_other_token", other_catcode, subtypes('1'));
-    primitive("token_if_group_begin_p:N", cat_ifeq_cmd, subtypes(open_catcode * 4 + l3_p_code));
-    primitive("token_if_group_begin:NTF", cat_ifeq_cmd, subtypes(open_catcode * 4 + l3_TF_code));
-    primitive("token_if_group_begin:NT", cat_ifeq_cmd, subtypes(open_catcode * 4 + l3_T_code));
-    primitive("token_if_group_begin:NF", cat_ifeq_cmd, subtypes(open_catcode * 4 + l3_F_code));
-    primitive("token_if_group_end_p:N", cat_ifeq_cmd, subtypes(close_catcode * 4 + l3_p_code));
-    primitive("token_if_group_end:NTF", cat_ifeq_cmd, subtypes(close_catcode * 4 + l3_TF_code));
-    primitive("token_if_group_end:NT", cat_ifeq_cmd, subtypes(close_catcode * 4 + l3_T_code));
-    primitive("token_if_group_end:NF", cat_ifeq_cmd, subtypes(close_catcode * 4 + l3_F_code));
-    primitive("token_if_math_toggle_p:N", cat_ifeq_cmd, subtypes(dollar_catcode * 4 + l3_p_code));
-    primitive("token_if_math_toggle:NTF", cat_ifeq_cmd, subtypes(dollar_catcode * 4 + l3_TF_code));
-    primitive("token_if_math_toggle:NT", cat_ifeq_cmd, subtypes(dollar_catcode * 4 + l3_T_code));
-    primitive("token_if_math_toggle:NF", cat_ifeq_cmd, subtypes(dollar_catcode * 4 + l3_F_code));
-    primitive("token_if_alignment_p:N", cat_ifeq_cmd, subtypes(alignment_catcode * 4 + l3_p_code));
-    primitive("token_if_alignment:NTF", cat_ifeq_cmd, subtypes(alignment_catcode * 4 + l3_TF_code));
-    primitive("token_if_alignment:NT", cat_ifeq_cmd, subtypes(alignment_catcode * 4 + l3_T_code));
-    primitive("token_if_alignment:NF", cat_ifeq_cmd, subtypes(alignment_catcode * 4 + l3_F_code));
-    primitive("token_if_parameter_p:N", cat_ifeq_cmd, subtypes(parameter_catcode * 4 + l3_p_code));
-    primitive("token_if_parameter:NTF", cat_ifeq_cmd, subtypes(parameter_catcode * 4 + l3_TF_code));
-    primitive("token_if_parameter:NT", cat_ifeq_cmd, subtypes(parameter_catcode * 4 + l3_T_code));
-    primitive("token_if_parameter:NF", cat_ifeq_cmd, subtypes(parameter_catcode * 4 + l3_F_code));
-    primitive("token_if_math_superscript_p:N", cat_ifeq_cmd, subtypes(hat_catcode * 4 + l3_p_code));
-    primitive("token_if_math_superscript:NTF", cat_ifeq_cmd, subtypes(hat_catcode * 4 + l3_TF_code));
-    primitive("token_if_math_superscript:NT", cat_ifeq_cmd, subtypes(hat_catcode * 4 + l3_T_code));
-    primitive("token_if_math_superscript:NF", cat_ifeq_cmd, subtypes(hat_catcode * 4 + l3_F_code));
-    primitive("token_if_math_subscript_p:N", cat_ifeq_cmd, subtypes(underscore_catcode * 4 + l3_p_code));
-    primitive("token_if_math_subscript:NTF", cat_ifeq_cmd, subtypes(underscore_catcode * 4 + l3_TF_code));
-    primitive("token_if_math_subscript:NT", cat_ifeq_cmd, subtypes(underscore_catcode * 4 + l3_T_code));
-    primitive("token_if_math_subscript:NF", cat_ifeq_cmd, subtypes(underscore_catcode * 4 + l3_F_code));
-    primitive("token_if_space_p:N", cat_ifeq_cmd, subtypes(space_catcode * 4 + l3_p_code));
-    primitive("token_if_space:NTF", cat_ifeq_cmd, subtypes(space_catcode * 4 + l3_TF_code));
-    primitive("token_if_space:NT", cat_ifeq_cmd, subtypes(space_catcode * 4 + l3_T_code));
-    primitive("token_if_space:NF", cat_ifeq_cmd, subtypes(space_catcode * 4 + l3_F_code));
-    primitive("token_if_other_p:N", cat_ifeq_cmd, subtypes(other_catcode * 4 + l3_p_code));
-    primitive("token_if_other:NTF", cat_ifeq_cmd, subtypes(other_catcode * 4 + l3_TF_code));
-    primitive("token_if_other:NT", cat_ifeq_cmd, subtypes(other_catcode * 4 + l3_T_code));
-    primitive("token_if_other:NF", cat_ifeq_cmd, subtypes(other_catcode * 4 + l3_F_code));
-    primitive("token_if_letter_p:N", cat_ifeq_cmd, subtypes(letter_catcode * 4 + l3_p_code));
-    primitive("token_if_letter:NTF", cat_ifeq_cmd, subtypes(letter_catcode * 4 + l3_TF_code));
-    primitive("token_if_letter:NT", cat_ifeq_cmd, subtypes(letter_catcode * 4 + l3_T_code));
-    primitive("token_if_letter:NF", cat_ifeq_cmd, subtypes(letter_catcode * 4 + l3_F_code));
-    primitive("token_if_active_p:N", cat_ifeq_cmd, subtypes(active_catcode * 4 + l3_p_code));
-    primitive("token_if_active:NTF", cat_ifeq_cmd, subtypes(active_catcode * 4 + l3_TF_code));
-    primitive("token_if_active:NT", cat_ifeq_cmd, subtypes(active_catcode * 4 + l3_T_code));
-    primitive("token_if_active:NF", cat_ifeq_cmd, subtypes(active_catcode * 4 + l3_F_code));
-    primitive("token_if_eq_catcode_p:NN", token_if_cmd, subtypes(tok_eq_cat_code * 4 + l3_p_code));
-    primitive("token_if_eq_charcode_p:NN", token_if_cmd, subtypes(tok_eq_char_code * 4 + l3_p_code));
-    primitive("token_if_eq_meaning_p:NN", token_if_cmd, subtypes(tok_eq_meaning_code * 4 + l3_p_code));
-    primitive("token_if_macro_p:N", token_if_cmd, subtypes(tok_if_macro_code * 4 + l3_p_code));
-    primitive("token_if_cs_p:N", token_if_cmd, subtypes(tok_if_cs_code * 4 + l3_p_code));
-    primitive("token_if_expandable_p:N", token_if_cmd, subtypes(tok_if_expandable_code * 4 + l3_p_code));
-    primitive("token_if_long_macro_p:N", token_if_cmd, subtypes(tok_if_long_code * 4 + l3_p_code));
-    primitive("token_if_protected_macro_p:N", token_if_cmd, subtypes(tok_if_prot_code * 4 + l3_p_code));
-    primitive("token_if_protected_long_macro_p:N", token_if_cmd, subtypes(tok_if_longprot_code * 4 + l3_p_code));
-    primitive("token_if_chardef_p:N", token_if_cmd, subtypes(tok_if_chardef_code * 4 + l3_p_code));
-    primitive("token_if_mathchardef_p:N", token_if_cmd, subtypes(tok_if_mathchardef_code * 4 + l3_p_code));
-    primitive("token_if_dim_register_p:N", token_if_cmd, subtypes(tok_if_dim_code * 4 + l3_p_code));
-    primitive("token_if_int_register_p:N", token_if_cmd, subtypes(tok_if_int_code * 4 + l3_p_code));
-    primitive("token_if_muskip_register_p:N", token_if_cmd, subtypes(tok_if_muskip_code * 4 + l3_p_code));
-    primitive("token_if_skip_register_p:N", token_if_cmd, subtypes(tok_if_skip_code * 4 + l3_p_code));
-    primitive("token_if_toks_register_p:N", token_if_cmd, subtypes(tok_if_toks_code * 4 + l3_p_code));
-    primitive("token_if_primitive_p:N", token_if_cmd, subtypes(tok_if_primitive_code * 4 + l3_p_code));
-    primitive("token_if_eq_catcode:NNTF", token_if_cmd, subtypes(tok_eq_cat_code * 4 + l3_TF_code));
-    primitive("token_if_eq_charcode:NNTF", token_if_cmd, subtypes(tok_eq_char_code * 4 + l3_TF_code));
-    primitive("token_if_eq_meaning:NNTF", token_if_cmd, subtypes(tok_eq_meaning_code * 4 + l3_TF_code));
-    primitive("token_if_macro:NTF", token_if_cmd, subtypes(tok_if_macro_code * 4 + l3_TF_code));
-    primitive("token_if_cs:NTF", token_if_cmd, subtypes(tok_if_cs_code * 4 + l3_TF_code));
-    primitive("token_if_expandable:NTF", token_if_cmd, subtypes(tok_if_expandable_code * 4 + l3_TF_code));
-    primitive("token_if_long_macro:NTF", token_if_cmd, subtypes(tok_if_long_code * 4 + l3_TF_code));
-    primitive("token_if_protected_macro:NTF", token_if_cmd, subtypes(tok_if_prot_code * 4 + l3_TF_code));
-    primitive("token_if_protected_long_macro:NTF", token_if_cmd, subtypes(tok_if_longprot_code * 4 + l3_TF_code));
-    primitive("token_if_chardef:NTF", token_if_cmd, subtypes(tok_if_chardef_code * 4 + l3_TF_code));
-    primitive("token_if_mathchardef:NTF", token_if_cmd, subtypes(tok_if_mathchardef_code * 4 + l3_TF_code));
-    primitive("token_if_dim_register:NTF", token_if_cmd, subtypes(tok_if_dim_code * 4 + l3_TF_code));
-    primitive("token_if_int_register:NTF", token_if_cmd, subtypes(tok_if_int_code * 4 + l3_TF_code));
-    primitive("token_if_muskip_register:NTF", token_if_cmd, subtypes(tok_if_muskip_code * 4 + l3_TF_code));
-    primitive("token_if_skip_register:NTF", token_if_cmd, subtypes(tok_if_skip_code * 4 + l3_TF_code));
-    primitive("token_if_toks_register:NTF", token_if_cmd, subtypes(tok_if_toks_code * 4 + l3_TF_code));
-    primitive("token_if_primitive:NTF", token_if_cmd, subtypes(tok_if_primitive_code * 4 + l3_TF_code));
-    primitive("token_if_eq_catcode:NNT", token_if_cmd, subtypes(tok_eq_cat_code * 4 + l3_T_code));
-    primitive("token_if_eq_charcode:NNT", token_if_cmd, subtypes(tok_eq_char_code * 4 + l3_T_code));
-    primitive("token_if_eq_meaning:NNT", token_if_cmd, subtypes(tok_eq_meaning_code * 4 + l3_T_code));
-    primitive("token_if_macro:NT", token_if_cmd, subtypes(tok_if_macro_code * 4 + l3_T_code));
-    primitive("token_if_cs:NT", token_if_cmd, subtypes(tok_if_cs_code * 4 + l3_T_code));
-    primitive("token_if_expandable:NT", token_if_cmd, subtypes(tok_if_expandable_code * 4 + l3_T_code));
-    primitive("token_if_long_macro:NT", token_if_cmd, subtypes(tok_if_long_code * 4 + l3_T_code));
-    primitive("token_if_protected_macro:NT", token_if_cmd, subtypes(tok_if_prot_code * 4 + l3_T_code));
-    primitive("token_if_protected_long_macro:NT", token_if_cmd, subtypes(tok_if_longprot_code * 4 + l3_T_code));
-    primitive("token_if_chardef:NT", token_if_cmd, subtypes(tok_if_chardef_code * 4 + l3_T_code));
-    primitive("token_if_mathchardef:NT", token_if_cmd, subtypes(tok_if_mathchardef_code * 4 + l3_T_code));
-    primitive("token_if_dim_register:NT", token_if_cmd, subtypes(tok_if_dim_code * 4 + l3_T_code));
-    primitive("token_if_int_register:NT", token_if_cmd, subtypes(tok_if_int_code * 4 + l3_T_code));
-    primitive("token_if_muskip_register:NT", token_if_cmd, subtypes(tok_if_muskip_code * 4 + l3_T_code));
-    primitive("token_if_skip_register:NT", token_if_cmd, subtypes(tok_if_skip_code * 4 + l3_T_code));
-    primitive("token_if_toks_register:NT", token_if_cmd, subtypes(tok_if_toks_code * 4 + l3_T_code));
-    primitive("token_if_primitive:NT", token_if_cmd, subtypes(tok_if_primitive_code * 4 + l3_T_code));
-    primitive("token_if_eq_catcode:NNF", token_if_cmd, subtypes(tok_eq_cat_code * 4 + l3_F_code));
-    primitive("token_if_eq_charcode:NNF", token_if_cmd, subtypes(tok_eq_char_code * 4 + l3_F_code));
-    primitive("token_if_eq_meaning:NNF", token_if_cmd, subtypes(tok_eq_meaning_code * 4 + l3_F_code));
-    primitive("token_if_macro:NF", token_if_cmd, subtypes(tok_if_macro_code * 4 + l3_F_code));
-    primitive("token_if_cs:NF", token_if_cmd, subtypes(tok_if_cs_code * 4 + l3_F_code));
-    primitive("token_if_expandable:NF", token_if_cmd, subtypes(tok_if_expandable_code * 4 + l3_F_code));
-    primitive("token_if_long_macro:NF", token_if_cmd, subtypes(tok_if_long_code * 4 + l3_F_code));
-    primitive("token_if_protected_macro:NF", token_if_cmd, subtypes(tok_if_prot_code * 4 + l3_F_code));
-    primitive("token_if_protected_long_macro:NF", token_if_cmd, subtypes(tok_if_longprot_code * 4 + l3_F_code));
-    primitive("token_if_chardef:NF", token_if_cmd, subtypes(tok_if_chardef_code * 4 + l3_F_code));
-    primitive("token_if_mathchardef:NF", token_if_cmd, subtypes(tok_if_mathchardef_code * 4 + l3_F_code));
-    primitive("token_if_dim_register:NF", token_if_cmd, subtypes(tok_if_dim_code * 4 + l3_F_code));
-    primitive("token_if_int_register:NF", token_if_cmd, subtypes(tok_if_int_code * 4 + l3_F_code));
-    primitive("token_if_muskip_register:NF", token_if_cmd, subtypes(tok_if_muskip_code * 4 + l3_F_code));
-    primitive("token_if_skip_register:NF", token_if_cmd, subtypes(tok_if_skip_code * 4 + l3_F_code));
-    primitive("token_if_toks_register:NF", token_if_cmd, subtypes(tok_if_toks_code * 4 + l3_F_code));
-    primitive("token_if_primitive:NF", token_if_cmd, subtypes(tok_if_primitive_code * 4 + l3_F_code));
-    primitive("tl_new:N", tl_basic_cmd, l3_tl_new_code);
-    primitive("tl_clear:N", tl_basic_cmd, l3_tl_clear_code);
-    primitive("tl_gclear:N", tl_basic_cmd, l3_tl_gclear_code);
-    primitive("tl_const:Nn", tl_basic_cmd, l3_tl_const_code);
-    primitive("tl_const:Nx", tl_basic_cmd, l3_tl_xconst_code);
-    primitive("tl_clear_new:N", tl_basic_cmd, l3_tl_clearnew_code);
-    primitive("tl_gclear_new:N", tl_basic_cmd, l3_tl_gclearnew_code);
-    primitive("tl_new:c", tl_basic_cmd, l3_tlx_new_code);
-    primitive("tl_clear:c", tl_basic_cmd, l3_tlx_clear_code);
-    primitive("tl_gclear:c", tl_basic_cmd, l3_tlx_gclear_code);
-    primitive("tl_const:cn", tl_basic_cmd, l3_tlx_const_code);
-    primitive("tl_const:cx", tl_basic_cmd, l3_tlx_xconst_code);
-    primitive("tl_clear_new:c", tl_basic_cmd, l3_tlx_clearnew_code);
-    primitive("tl_gclear_new:c", tl_basic_cmd, l3_tlx_gclearnew_code);
-    primitive("tl_concat:NNN", tl_concat_cmd, zero_code);
-    primitive("tl_concat:ccc", tl_concat_cmd, one_code);
-    primitive("tl_gconcat:NNN", tl_concat_cmd, two_code);
-    primitive("tl_gconcat:ccc", tl_concat_cmd, three_code);
-    primitive("tl_set:Nn", tl_set_cmd, l3expn_code);
-    primitive("tl_set:No", tl_set_cmd, l3expo_code);
-    primitive("tl_set:Nf", tl_set_cmd, l3expf_code);
-    primitive("tl_set:Nx", tl_set_cmd, l3expx_code);
-    primitive("tl_set:NV", tl_set_cmd, l3expV_code);
-    primitive("tl_set:Nv", tl_set_cmd, l3expv_code);
-    primitive("tl_set:cn", tl_set_cmd, subtypes(l3expn_code + 9));
-    primitive("tl_set:co", tl_set_cmd, subtypes(l3expo_code + 9));
-    primitive("tl_set:cf", tl_set_cmd, subtypes(l3expf_code + 9));
-    primitive("tl_set:cx", tl_set_cmd, subtypes(l3expx_code + 9));
-    primitive("tl_set:cV", tl_set_cmd, subtypes(l3expV_code + 9));
-    primitive("tl_set:cv", tl_set_cmd, subtypes(l3expv_code + 9));
-    primitive("tl_gset:Nn", tl_set_cmd, subtypes(l3expn_code + 18));
-    primitive("tl_gset:No", tl_set_cmd, subtypes(l3expo_code + 18));
-    primitive("tl_gset:Nf", tl_set_cmd, subtypes(l3expf_code + 18));
-    primitive("tl_gset:Nx", tl_set_cmd, subtypes(l3expx_code + 18));
-    primitive("tl_gset:NV", tl_set_cmd, subtypes(l3expV_code + 18));
-    primitive("tl_gset:Nv", tl_set_cmd, subtypes(l3expv_code + 18));
-    primitive("tl_gset:cn", tl_set_cmd, subtypes(l3expn_code + 9 + 18));
-    primitive("tl_gset:co", tl_set_cmd, subtypes(l3expo_code + 9 + 18));
-    primitive("tl_gset:cf", tl_set_cmd, subtypes(l3expf_code + 9 + 18));
-    primitive("tl_gset:cx", tl_set_cmd, subtypes(l3expx_code + 9 + 18));
-    primitive("tl_gset:cV", tl_set_cmd, subtypes(l3expV_code + 9 + 18));
-    primitive("tl_gset:cv", tl_set_cmd, subtypes(l3expv_code + 9 + 18));
+    lazy_primitive("cs_generate_from_arg_count:NNnn", l3_gen_from_ac_cmd, zero_code);
+    lazy_primitive("cs_generate_from_arg_count:cNnn", l3_gen_from_ac_cmd, one_code);
+    lazy_primitive("cs_generate_from_arg_count:Ncnn", l3_gen_from_ac_cmd, two_code);
+    lazy_primitive("::n", l3expand_aux_cmd, l3expn_code);
+    lazy_primitive("::N", l3expand_aux_cmd, l3expN_code);
+    lazy_primitive("::p", l3expand_aux_cmd, l3expp_code);
+    lazy_primitive("::c", l3expand_aux_cmd, l3expc_code);
+    lazy_primitive("::o", l3expand_aux_cmd, l3expo_code);
+    lazy_primitive("::f", l3expand_aux_cmd, l3expf_code);
+    lazy_primitive("::x", l3expand_aux_cmd, l3expx_code);
+    lazy_primitive("::V", l3expand_aux_cmd, l3expV_code);
+    lazy_primitive("::v", l3expand_aux_cmd, l3expv_code);
+    lazy_primitive("::f_unbraced", l3expand_aux_cmd, l3expfu_code);
+    lazy_primitive("::o_unbraced", l3expand_aux_cmd, l3expou_code);
+    lazy_primitive("::v_unbraced", l3expand_aux_cmd, l3expvu_code);
+    lazy_primitive("::V_unbraced", l3expand_aux_cmd, l3expVu_code);
+    lazy_primitive("::x_unbraced", l3expand_aux_cmd, l3expxu_code);
+    lazy_primitive("exp_not:c", l3noexpand_cmd, l3expc_code);
+    lazy_primitive("exp_not:f", l3noexpand_cmd, l3expf_code);
+    lazy_primitive("exp_not:o", l3noexpand_cmd, l3expo_code);
+    lazy_primitive("exp_not:v", l3noexpand_cmd, l3expv_code);
+    lazy_primitive("exp_not:V", l3noexpand_cmd, l3expV_code);
+    lazy_primitive("exp_args:No", l3expand_base_cmd, l3exp_No_code);
+    lazy_primitive("exp_args:NNo", l3expand_base_cmd, l3exp_NNo_code);
+    lazy_primitive("exp_args:NNNo", l3expand_base_cmd, l3exp_NNNo_code);
+    lazy_primitive("exp_args:NNc", l3expand_base_cmd, l3exp_NNc_code);
+    lazy_primitive("exp_args:Ncc", l3expand_base_cmd, l3exp_Ncc_code);
+    lazy_primitive("exp_args:Nccc", l3expand_base_cmd, l3exp_Nccc_code);
+    lazy_primitive("exp_args:Nf", l3expand_base_cmd, l3exp_Nf_code);
+    lazy_primitive("exp_args:NNf", l3expand_base_cmd, l3exp_NNf_code);
+    lazy_primitive("exp_args:Nv", l3expand_base_cmd, l3exp_Nv_code);
+    lazy_primitive("exp_args:NNv", l3expand_base_cmd, l3exp_NNv_code);
+    lazy_primitive("exp_args:NV", l3expand_base_cmd, l3exp_NV_code);
+    lazy_primitive("exp_args:NNV", l3expand_base_cmd, l3exp_NNV_code);
+    lazy_primitive("exp_args:NNNV", l3expand_base_cmd, l3exp_NNNV_code);
+    lazy_primitive("exp_args:Nco", l3expand_base_cmd, l3exp_Nco_code);
+    lazy_primitive("exp_args:Ncf", l3expand_base_cmd, l3exp_Ncf_code);
+    lazy_primitive("exp_args:NVV", l3expand_base_cmd, l3exp_NVV_code);
+    lazy_primitive("exp_args:NcNc", l3expand_base_cmd, l3exp_NcNc_code);
+    lazy_primitive("exp_args:Ncco", l3expand_base_cmd, l3exp_Ncco_code);
+    lazy_primitive("exp_args:Nx", l3expand_base_cmd, l3exp_Nx_code);
+    lazy_primitive("exp_args:Nnc", l3expand_base_cmd, l3exp_Nnc_code);
+    lazy_primitive("exp_args:Nfo", l3expand_base_cmd, l3exp_Nfo_code);
+    lazy_primitive("exp_args:Nff", l3expand_base_cmd, l3exp_Nff_code);
+    lazy_primitive("exp_args:Nnf", l3expand_base_cmd, l3exp_Nnf_code);
+    lazy_primitive("exp_args:Nno", l3expand_base_cmd, l3exp_Nno_code);
+    lazy_primitive("exp_args:NnV", l3expand_base_cmd, l3exp_NnV_code);
+    lazy_primitive("exp_args:Noo", l3expand_base_cmd, l3exp_Noo_code);
+    lazy_primitive("exp_args:Nof", l3expand_base_cmd, l3exp_Nof_code);
+    lazy_primitive("exp_args:Noc", l3expand_base_cmd, l3exp_Noc_code);
+    lazy_primitive("exp_args:NNx", l3expand_base_cmd, l3exp_NNx_code);
+    lazy_primitive("exp_args:Ncx", l3expand_base_cmd, l3exp_Ncx_code);
+    lazy_primitive("exp_args:Nnx", l3expand_base_cmd, l3exp_Nnx_code);
+    lazy_primitive("exp_args:Nox", l3expand_base_cmd, l3exp_Nox_code);
+    lazy_primitive("exp_args:Nxo", l3expand_base_cmd, l3exp_Nxo_code);
+    lazy_primitive("exp_args:Nxx", l3expand_base_cmd, l3exp_Nxx_code);
+    lazy_primitive("exp_args:NNno", l3expand_base_cmd, l3exp_NNno_code);
+    lazy_primitive("exp_args:NNoo", l3expand_base_cmd, l3exp_NNoo_code);
+    lazy_primitive("exp_args:Nnnc", l3expand_base_cmd, l3exp_Nnnc_code);
+    lazy_primitive("exp_args:Nnno", l3expand_base_cmd, l3exp_Nnno_code);
+    lazy_primitive("exp_args:Nooo", l3expand_base_cmd, l3exp_Nooo_code);
+    lazy_primitive("exp_args:NNnx", l3expand_base_cmd, l3exp_NNnx_code);
+    lazy_primitive("exp_args:NNox", l3expand_base_cmd, l3exp_NNox_code);
+    lazy_primitive("exp_args:Nnnx", l3expand_base_cmd, l3exp_Nnnx_code);
+    lazy_primitive("exp_args:Nnox", l3expand_base_cmd, l3exp_Nnox_code);
+    lazy_primitive("exp_args:Nccx", l3expand_base_cmd, l3exp_Nccx_code);
+    lazy_primitive("exp_args:Ncnx", l3expand_base_cmd, l3exp_Ncnx_code);
+    lazy_primitive("exp_args:Noox", l3expand_base_cmd, l3exp_Noox_code);
+    lazy_primitive("exp_last_unbraced:NV", l3expand_base_cmd, l3exp_NVu_code);
+    lazy_primitive("exp_last_unbraced:Nv", l3expand_base_cmd, l3exp_Nvu_code);
+    lazy_primitive("exp_last_unbraced:No", l3expand_base_cmd, l3exp_Nou_code);
+    lazy_primitive("exp_last_unbraced:Nf", l3expand_base_cmd, l3exp_Nfu_code);
+    lazy_primitive("exp_last_unbraced:Nco", l3expand_base_cmd, l3exp_Ncou_code);
+    lazy_primitive("exp_last_unbraced:NcV", l3expand_base_cmd, l3exp_NcVu_code);
+    lazy_primitive("exp_last_unbraced:NNV", l3expand_base_cmd, l3exp_NNVu_code);
+    lazy_primitive("exp_last_unbraced:NNo", l3expand_base_cmd, l3exp_NNou_code);
+    lazy_primitive("exp_last_unbraced:NNNV", l3expand_base_cmd, l3exp_NNNVu_code);
+    lazy_primitive("exp_last_unbraced:NNNo", l3expand_base_cmd, l3exp_NNNou_code);
+    lazy_primitive("exp_last_unbraced:Nno", l3expand_base_cmd, l3exp_Nnou_code);
+    lazy_primitive("exp_last_unbraced:Noo", l3expand_base_cmd, l3exp_Noou_code);
+    lazy_primitive("exp_last_unbraced:Nfo", l3expand_base_cmd, l3exp_Nfou_code);
+    lazy_primitive("exp_last_unbraced:NnNo", l3expand_base_cmd, l3exp_NnNou_code);
+    lazy_primitive("exp_last_unbraced:Nx", l3expand_base_cmd, l3exp_Nxu_code);
+    lazy_primitive("exp_last_two_unbraced:Noo", l3expand_base_cmd, l3exp_Nouou_code);
+    lazy_primitive("cs_if_eq_p:NN", l3_ifx_cmd, l3_p_NN_code);
+    lazy_primitive("cs_if_eq:NNTF", l3_ifx_cmd, l3_TF_NN_code);
+    lazy_primitive("cs_if_eq:NNT", l3_ifx_cmd, l3_T_NN_code);
+    lazy_primitive("cs_if_eq:NNF", l3_ifx_cmd, l3_F_NN_code);
+    lazy_primitive("cs_if_eq_p:Nc", l3_ifx_cmd, l3_p_Nc_code);
+    lazy_primitive("cs_if_eq:NcTF", l3_ifx_cmd, l3_TF_Nc_code);
+    lazy_primitive("cs_if_eq:NcT", l3_ifx_cmd, l3_T_Nc_code);
+    lazy_primitive("cs_if_eq:NcF", l3_ifx_cmd, l3_F_Nc_code);
+    lazy_primitive("cs_if_eq_p:cN", l3_ifx_cmd, l3_p_cN_code);
+    lazy_primitive("cs_if_eq:cNTF", l3_ifx_cmd, l3_TF_cN_code);
+    lazy_primitive("cs_if_eq:cNT", l3_ifx_cmd, l3_T_cN_code);
+    lazy_primitive("cs_if_eq:cNF", l3_ifx_cmd, l3_F_cN_code);
+    lazy_primitive("cs_if_eq_p:cc", l3_ifx_cmd, l3_p_cc_code);
+    lazy_primitive("cs_if_eq:ccTF", l3_ifx_cmd, l3_TF_cc_code);
+    lazy_primitive("cs_if_eq:ccT", l3_ifx_cmd, l3_T_cc_code);
+    lazy_primitive("cs_if_eq:ccF", l3_ifx_cmd, l3_F_cc_code);
+    lazy_primitive("str_if_eq_p:nn", l3str_ifeq_cmd, l3_p_code);
+    lazy_primitive("str_if_eq:nnTF", l3str_ifeq_cmd, l3_TF_code);
+    lazy_primitive("str_if_eq:nnT", l3str_ifeq_cmd, l3_T_code);
+    lazy_primitive("str_if_eq:nnF", l3str_ifeq_cmd, l3_F_code);
+    lazy_primitive("str_if_eq_x_p:nn", l3str_ifeq_cmd, subtypes(l3_p_code + 4));
+    lazy_primitive("str_if_eq_x:nnTF", l3str_ifeq_cmd, subtypes(l3_TF_code + 4));
+    lazy_primitive("str_if_eq_x:nnT", l3str_ifeq_cmd, subtypes(l3_T_code + 4));
+    lazy_primitive("str_if_eq_x:nnF", l3str_ifeq_cmd, subtypes(l3_F_code + 4));
+    lazy_primitive("str_if_eq_p:Vn", l3str_ifeq_cmd, subtypes(l3_p_code + 8));
+    lazy_primitive("str_if_eq:VnTF", l3str_ifeq_cmd, subtypes(l3_TF_code + 8));
+    lazy_primitive("str_if_eq:VnT", l3str_ifeq_cmd, subtypes(l3_T_code + 8));
+    lazy_primitive("str_if_eq:VnF", l3str_ifeq_cmd, subtypes(l3_F_code + 8));
+    lazy_primitive("str_if_eq_p:on", l3str_ifeq_cmd, subtypes(l3_p_code + 12));
+    lazy_primitive("str_if_eq:onTF", l3str_ifeq_cmd, subtypes(l3_TF_code + 12));
+    lazy_primitive("str_if_eq:onT", l3str_ifeq_cmd, subtypes(l3_T_code + 12));
+    lazy_primitive("str_if_eq:onF", l3str_ifeq_cmd, subtypes(l3_F_code + 12));
+    lazy_primitive("str_if_eq_p:no", l3str_ifeq_cmd, subtypes(l3_p_code + 16));
+    lazy_primitive("str_if_eq:noTF", l3str_ifeq_cmd, subtypes(l3_TF_code + 16));
+    lazy_primitive("str_if_eq:noT", l3str_ifeq_cmd, subtypes(l3_T_code + 16));
+    lazy_primitive("str_if_eq:noF", l3str_ifeq_cmd, subtypes(l3_F_code + 16));
+    lazy_primitive("str_if_eq_p:nV", l3str_ifeq_cmd, subtypes(l3_p_code + 20));
+    lazy_primitive("str_if_eq:nVTF", l3str_ifeq_cmd, subtypes(l3_TF_code + 20));
+    lazy_primitive("str_if_eq:nVT", l3str_ifeq_cmd, subtypes(l3_T_code + 20));
+    lazy_primitive("str_if_eq:nVF", l3str_ifeq_cmd, subtypes(l3_F_code + 20));
+    lazy_primitive("str_if_eq_p:VV", l3str_ifeq_cmd, subtypes(l3_p_code + 24));
+    lazy_primitive("str_if_eq:VVTF", l3str_ifeq_cmd, subtypes(l3_TF_code + 24));
+    lazy_primitive("str_if_eq:VVT", l3str_ifeq_cmd, subtypes(l3_T_code + 24));
+    lazy_primitive("str_if_eq:VVF", l3str_ifeq_cmd, subtypes(l3_F_code + 24));
+    lazy_primitive("str_case:nn", l3str_case_cmd, l3_p_code);
+    lazy_primitive("str_case:nnTF", l3str_case_cmd, l3_TF_code);
+    lazy_primitive("str_case:nnT", l3str_case_cmd, l3_T_code);
+    lazy_primitive("str_case:nnF", l3str_case_cmd, l3_F_code);
+    lazy_primitive("str_case:nnn", l3str_case_cmd, l3_F_code);
+    lazy_primitive("str_case_x:nn", l3str_case_cmd, subtypes(l3_p_code + 4));
+    lazy_primitive("str_case_x:nnTF", l3str_case_cmd, subtypes(l3_TF_code + 4));
+    lazy_primitive("str_case_x:nnT", l3str_case_cmd, subtypes(l3_T_code + 4));
+    lazy_primitive("str_case_x:nnF", l3str_case_cmd, subtypes(l3_F_code + 4));
+    lazy_primitive("str_case_x:nnn", l3str_case_cmd, subtypes(l3_F_code + 4));
+    lazy_primitive("str_case:on", l3str_case_cmd, subtypes(l3_p_code + 8));
+    lazy_primitive("str_case:onTF", l3str_case_cmd, subtypes(l3_TF_code + 8));
+    lazy_primitive("str_case:onT", l3str_case_cmd, subtypes(l3_T_code + 8));
+    lazy_primitive("str_case:onF", l3str_case_cmd, subtypes(l3_F_code + 8));
+    lazy_primitive("str_case:onn", l3str_case_cmd, subtypes(l3_F_code + 8));
+    lazy_primitive("char_set_catcode_escape:n", l3_set_cat_cmd, subtypes(escape_catcode));
+    lazy_primitive("char_set_catcode_group_begin:n", l3_set_cat_cmd, subtypes(open_catcode));
+    lazy_primitive("char_set_catcode_group_end:n", l3_set_cat_cmd, subtypes(close_catcode));
+    lazy_primitive("char_set_catcode_math_toggle:n", l3_set_cat_cmd, subtypes(dollar_catcode));
+    lazy_primitive("char_set_catcode_alignment:n", l3_set_cat_cmd, subtypes(alignment_catcode));
+    lazy_primitive("char_set_catcode_end_line:n", l3_set_cat_cmd, subtypes(eol_catcode));
+    lazy_primitive("char_set_catcode_parameter:n", l3_set_cat_cmd, subtypes(parameter_catcode));
+    lazy_primitive("char_set_catcode_math_superscript:n", l3_set_cat_cmd, subtypes(hat_catcode));
+    lazy_primitive("char_set_catcode_math_subscript:n", l3_set_cat_cmd, subtypes(underscore_catcode));
+    lazy_primitive("char_set_catcode_ignore:n", l3_set_cat_cmd, subtypes(ignored_catcode));
+    lazy_primitive("char_set_catcode_space:n", l3_set_cat_cmd, subtypes(space_catcode));
+    lazy_primitive("char_set_catcode_letter:n", l3_set_cat_cmd, subtypes(letter_catcode));
+    lazy_primitive("char_set_catcode_other:n", l3_set_cat_cmd, subtypes(other_catcode));
+    lazy_primitive("char_set_catcode_active:n", l3_set_cat_cmd, subtypes(active_catcode));
+    lazy_primitive("char_set_catcode_invalid:n", l3_set_cat_cmd, subtypes(invalid_catcode));
+    lazy_primitive("char_set_catcode_comment:n", l3_set_cat_cmd, subtypes(comment_catcode));
+    lazy_primitive("char_set_catcode_escape:N", l3_set_cat_cmd, subtypes(escape_catcode + 16));
+    lazy_primitive("char_set_catcode_group_begin:N", l3_set_cat_cmd, subtypes(open_catcode + 16));
+    lazy_primitive("char_set_catcode_group_end:N", l3_set_cat_cmd, subtypes(close_catcode + 16));
+    lazy_primitive("char_set_catcode_math_toggle:N", l3_set_cat_cmd, subtypes(dollar_catcode + 16));
+    lazy_primitive("char_set_catcode_alignment:N", l3_set_cat_cmd, subtypes(alignment_catcode + 16));
+    lazy_primitive("char_set_catcode_end_line:N", l3_set_cat_cmd, subtypes(eol_catcode + 16));
+    lazy_primitive("char_set_catcode_parameter:N", l3_set_cat_cmd, subtypes(parameter_catcode + 16));
+    lazy_primitive("char_set_catcode_math_superscript:N", l3_set_cat_cmd, subtypes(hat_catcode + 16));
+    lazy_primitive("char_set_catcode_math_subscript:N", l3_set_cat_cmd, subtypes(underscore_catcode + 16));
+    lazy_primitive("char_set_catcode_ignore:N", l3_set_cat_cmd, subtypes(ignored_catcode + 16));
+    lazy_primitive("char_set_catcode_space:N", l3_set_cat_cmd, subtypes(space_catcode + 16));
+    lazy_primitive("char_set_catcode_letter:N", l3_set_cat_cmd, subtypes(letter_catcode + 16));
+    lazy_primitive("char_set_catcode_other:N", l3_set_cat_cmd, subtypes(other_catcode + 16));
+    lazy_primitive("char_set_catcode_active:N", l3_set_cat_cmd, subtypes(active_catcode + 16));
+    lazy_primitive("char_set_catcode_invalid:N", l3_set_cat_cmd, subtypes(invalid_catcode + 16));
+    lazy_primitive("char_set_catcode_comment:N", l3_set_cat_cmd, subtypes(comment_catcode + 16));
+    lazy_primitive("char_set_catcode:nn", l3_set_num_cmd, setcat_code);
+    lazy_primitive("char_value_catcode:n", l3E_set_num_cmd, thecat_code);
+    lazy_primitive("char_show_value_catcode:n", l3_set_num_cmd, showcat_code);
+    lazy_primitive("char_set_mathcode:nn", l3_set_num_cmd, setmath_code);
+    lazy_primitive("char_value_mathcode:n", l3E_set_num_cmd, themath_code);
+    lazy_primitive("char_show_value_mathcode:n", l3_set_num_cmd, showmath_code);
+    lazy_primitive("char_set_lccode:nn", l3_set_num_cmd, setlc_code);
+    lazy_primitive("char_value_lccode:n", l3E_set_num_cmd, thelc_code);
+    lazy_primitive("char_show_value_lccode:n", l3_set_num_cmd, showlc_code);
+    lazy_primitive("char_set_uccode:nn", l3_set_num_cmd, setuc_code);
+    lazy_primitive("char_value_uccode:n", l3E_set_num_cmd, theuc_code);
+    lazy_primitive("char_show_value_uccode:n", l3_set_num_cmd, showuc_code);
+    lazy_primitive("char_set_sfcode:nn", l3_set_num_cmd, setsf_code);
+    lazy_primitive("char_value_sfcode:n", l3E_set_num_cmd, thesf_code);
+    lazy_primitive("char_show_value_sfcode:n", l3_set_num_cmd, showsf_code);
+    lazy_primitive("c_group_begin_token", open_catcode, subtypes('{'));
+    lazy_primitive("c_group_end_token", close_catcode, subtypes('}'));
+    lazy_primitive("c_math_toggle_token", dollar_catcode, subtypes('*'));
+    lazy_primitive("c_alignment_token", alignment_catcode, subtypes('*'));
+    lazy_primitive("c_parameter_token", parameter_catcode, subtypes('#'));
+    lazy_primitive("c_math_superscript_token", hat_catcode, subtypes('^'));
+    lazy_primitive("c_math_subscript_token", underscore_catcode, subtypes('*'));
+    lazy_primitive("c_space_token", space_catcode, subtypes('~'));
+    lazy_primitive("c_catcode_letter_token", letter_catcode, subtypes('a'));
+    lazy_primitive("c_catcode_other_token", other_catcode, subtypes('1'));
+    lazy_primitive("token_if_group_begin_p:N", cat_ifeq_cmd, subtypes(open_catcode * 4 + l3_p_code));
+    lazy_primitive("token_if_group_begin:NTF", cat_ifeq_cmd, subtypes(open_catcode * 4 + l3_TF_code));
+    lazy_primitive("token_if_group_begin:NT", cat_ifeq_cmd, subtypes(open_catcode * 4 + l3_T_code));
+    lazy_primitive("token_if_group_begin:NF", cat_ifeq_cmd, subtypes(open_catcode * 4 + l3_F_code));
+    lazy_primitive("token_if_group_end_p:N", cat_ifeq_cmd, subtypes(close_catcode * 4 + l3_p_code));
+    lazy_primitive("token_if_group_end:NTF", cat_ifeq_cmd, subtypes(close_catcode * 4 + l3_TF_code));
+    lazy_primitive("token_if_group_end:NT", cat_ifeq_cmd, subtypes(close_catcode * 4 + l3_T_code));
+    lazy_primitive("token_if_group_end:NF", cat_ifeq_cmd, subtypes(close_catcode * 4 + l3_F_code));
+    lazy_primitive("token_if_math_toggle_p:N", cat_ifeq_cmd, subtypes(dollar_catcode * 4 + l3_p_code));
+    lazy_primitive("token_if_math_toggle:NTF", cat_ifeq_cmd, subtypes(dollar_catcode * 4 + l3_TF_code));
+    lazy_primitive("token_if_math_toggle:NT", cat_ifeq_cmd, subtypes(dollar_catcode * 4 + l3_T_code));
+    lazy_primitive("token_if_math_toggle:NF", cat_ifeq_cmd, subtypes(dollar_catcode * 4 + l3_F_code));
+    lazy_primitive("token_if_alignment_p:N", cat_ifeq_cmd, subtypes(alignment_catcode * 4 + l3_p_code));
+    lazy_primitive("token_if_alignment:NTF", cat_ifeq_cmd, subtypes(alignment_catcode * 4 + l3_TF_code));
+    lazy_primitive("token_if_alignment:NT", cat_ifeq_cmd, subtypes(alignment_catcode * 4 + l3_T_code));
+    lazy_primitive("token_if_alignment:NF", cat_ifeq_cmd, subtypes(alignment_catcode * 4 + l3_F_code));
+    lazy_primitive("token_if_parameter_p:N", cat_ifeq_cmd, subtypes(parameter_catcode * 4 + l3_p_code));
+    lazy_primitive("token_if_parameter:NTF", cat_ifeq_cmd, subtypes(parameter_catcode * 4 + l3_TF_code));
+    lazy_primitive("token_if_parameter:NT", cat_ifeq_cmd, subtypes(parameter_catcode * 4 + l3_T_code));
+    lazy_primitive("token_if_parameter:NF", cat_ifeq_cmd, subtypes(parameter_catcode * 4 + l3_F_code));
+    lazy_primitive("token_if_math_superscript_p:N", cat_ifeq_cmd, subtypes(hat_catcode * 4 + l3_p_code));
+    lazy_primitive("token_if_math_superscript:NTF", cat_ifeq_cmd, subtypes(hat_catcode * 4 + l3_TF_code));
+    lazy_primitive("token_if_math_superscript:NT", cat_ifeq_cmd, subtypes(hat_catcode * 4 + l3_T_code));
+    lazy_primitive("token_if_math_superscript:NF", cat_ifeq_cmd, subtypes(hat_catcode * 4 + l3_F_code));
+    lazy_primitive("token_if_math_subscript_p:N", cat_ifeq_cmd, subtypes(underscore_catcode * 4 + l3_p_code));
+    lazy_primitive("token_if_math_subscript:NTF", cat_ifeq_cmd, subtypes(underscore_catcode * 4 + l3_TF_code));
+    lazy_primitive("token_if_math_subscript:NT", cat_ifeq_cmd, subtypes(underscore_catcode * 4 + l3_T_code));
+    lazy_primitive("token_if_math_subscript:NF", cat_ifeq_cmd, subtypes(underscore_catcode * 4 + l3_F_code));
+    lazy_primitive("token_if_space_p:N", cat_ifeq_cmd, subtypes(space_catcode * 4 + l3_p_code));
+    lazy_primitive("token_if_space:NTF", cat_ifeq_cmd, subtypes(space_catcode * 4 + l3_TF_code));
+    lazy_primitive("token_if_space:NT", cat_ifeq_cmd, subtypes(space_catcode * 4 + l3_T_code));
+    lazy_primitive("token_if_space:NF", cat_ifeq_cmd, subtypes(space_catcode * 4 + l3_F_code));
+    lazy_primitive("token_if_other_p:N", cat_ifeq_cmd, subtypes(other_catcode * 4 + l3_p_code));
+    lazy_primitive("token_if_other:NTF", cat_ifeq_cmd, subtypes(other_catcode * 4 + l3_TF_code));
+    lazy_primitive("token_if_other:NT", cat_ifeq_cmd, subtypes(other_catcode * 4 + l3_T_code));
+    lazy_primitive("token_if_other:NF", cat_ifeq_cmd, subtypes(other_catcode * 4 + l3_F_code));
+    lazy_primitive("token_if_letter_p:N", cat_ifeq_cmd, subtypes(letter_catcode * 4 + l3_p_code));
+    lazy_primitive("token_if_letter:NTF", cat_ifeq_cmd, subtypes(letter_catcode * 4 + l3_TF_code));
+    lazy_primitive("token_if_letter:NT", cat_ifeq_cmd, subtypes(letter_catcode * 4 + l3_T_code));
+    lazy_primitive("token_if_letter:NF", cat_ifeq_cmd, subtypes(letter_catcode * 4 + l3_F_code));
+    lazy_primitive("token_if_active_p:N", cat_ifeq_cmd, subtypes(active_catcode * 4 + l3_p_code));
+    lazy_primitive("token_if_active:NTF", cat_ifeq_cmd, subtypes(active_catcode * 4 + l3_TF_code));
+    lazy_primitive("token_if_active:NT", cat_ifeq_cmd, subtypes(active_catcode * 4 + l3_T_code));
+    lazy_primitive("token_if_active:NF", cat_ifeq_cmd, subtypes(active_catcode * 4 + l3_F_code));
+    lazy_primitive("token_if_eq_catcode_p:NN", token_if_cmd, subtypes(tok_eq_cat_code * 4 + l3_p_code));
+    lazy_primitive("token_if_eq_charcode_p:NN", token_if_cmd, subtypes(tok_eq_char_code * 4 + l3_p_code));
+    lazy_primitive("token_if_eq_meaning_p:NN", token_if_cmd, subtypes(tok_eq_meaning_code * 4 + l3_p_code));
+    lazy_primitive("token_if_macro_p:N", token_if_cmd, subtypes(tok_if_macro_code * 4 + l3_p_code));
+    lazy_primitive("token_if_cs_p:N", token_if_cmd, subtypes(tok_if_cs_code * 4 + l3_p_code));
+    lazy_primitive("token_if_expandable_p:N", token_if_cmd, subtypes(tok_if_expandable_code * 4 + l3_p_code));
+    lazy_primitive("token_if_long_macro_p:N", token_if_cmd, subtypes(tok_if_long_code * 4 + l3_p_code));
+    lazy_primitive("token_if_protected_macro_p:N", token_if_cmd, subtypes(tok_if_prot_code * 4 + l3_p_code));
+    lazy_primitive("token_if_protected_long_macro_p:N", token_if_cmd, subtypes(tok_if_longprot_code * 4 + l3_p_code));
+    lazy_primitive("token_if_chardef_p:N", token_if_cmd, subtypes(tok_if_chardef_code * 4 + l3_p_code));
+    lazy_primitive("token_if_mathchardef_p:N", token_if_cmd, subtypes(tok_if_mathchardef_code * 4 + l3_p_code));
+    lazy_primitive("token_if_dim_register_p:N", token_if_cmd, subtypes(tok_if_dim_code * 4 + l3_p_code));
+    lazy_primitive("token_if_int_register_p:N", token_if_cmd, subtypes(tok_if_int_code * 4 + l3_p_code));
+    lazy_primitive("token_if_muskip_register_p:N", token_if_cmd, subtypes(tok_if_muskip_code * 4 + l3_p_code));
+    lazy_primitive("token_if_skip_register_p:N", token_if_cmd, subtypes(tok_if_skip_code * 4 + l3_p_code));
+    lazy_primitive("token_if_toks_register_p:N", token_if_cmd, subtypes(tok_if_toks_code * 4 + l3_p_code));
+    lazy_primitive("token_if_primitive_p:N", token_if_cmd, subtypes(tok_if_primitive_code * 4 + l3_p_code));
+    lazy_primitive("token_if_eq_catcode:NNTF", token_if_cmd, subtypes(tok_eq_cat_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_eq_charcode:NNTF", token_if_cmd, subtypes(tok_eq_char_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_eq_meaning:NNTF", token_if_cmd, subtypes(tok_eq_meaning_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_macro:NTF", token_if_cmd, subtypes(tok_if_macro_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_cs:NTF", token_if_cmd, subtypes(tok_if_cs_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_expandable:NTF", token_if_cmd, subtypes(tok_if_expandable_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_long_macro:NTF", token_if_cmd, subtypes(tok_if_long_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_protected_macro:NTF", token_if_cmd, subtypes(tok_if_prot_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_protected_long_macro:NTF", token_if_cmd, subtypes(tok_if_longprot_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_chardef:NTF", token_if_cmd, subtypes(tok_if_chardef_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_mathchardef:NTF", token_if_cmd, subtypes(tok_if_mathchardef_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_dim_register:NTF", token_if_cmd, subtypes(tok_if_dim_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_int_register:NTF", token_if_cmd, subtypes(tok_if_int_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_muskip_register:NTF", token_if_cmd, subtypes(tok_if_muskip_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_skip_register:NTF", token_if_cmd, subtypes(tok_if_skip_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_toks_register:NTF", token_if_cmd, subtypes(tok_if_toks_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_primitive:NTF", token_if_cmd, subtypes(tok_if_primitive_code * 4 + l3_TF_code));
+    lazy_primitive("token_if_eq_catcode:NNT", token_if_cmd, subtypes(tok_eq_cat_code * 4 + l3_T_code));
+    lazy_primitive("token_if_eq_charcode:NNT", token_if_cmd, subtypes(tok_eq_char_code * 4 + l3_T_code));
+    lazy_primitive("token_if_eq_meaning:NNT", token_if_cmd, subtypes(tok_eq_meaning_code * 4 + l3_T_code));
+    lazy_primitive("token_if_macro:NT", token_if_cmd, subtypes(tok_if_macro_code * 4 + l3_T_code));
+    lazy_primitive("token_if_cs:NT", token_if_cmd, subtypes(tok_if_cs_code * 4 + l3_T_code));
+    lazy_primitive("token_if_expandable:NT", token_if_cmd, subtypes(tok_if_expandable_code * 4 + l3_T_code));
+    lazy_primitive("token_if_long_macro:NT", token_if_cmd, subtypes(tok_if_long_code * 4 + l3_T_code));
+    lazy_primitive("token_if_protected_macro:NT", token_if_cmd, subtypes(tok_if_prot_code * 4 + l3_T_code));
+    lazy_primitive("token_if_protected_long_macro:NT", token_if_cmd, subtypes(tok_if_longprot_code * 4 + l3_T_code));
+    lazy_primitive("token_if_chardef:NT", token_if_cmd, subtypes(tok_if_chardef_code * 4 + l3_T_code));
+    lazy_primitive("token_if_mathchardef:NT", token_if_cmd, subtypes(tok_if_mathchardef_code * 4 + l3_T_code));
+    lazy_primitive("token_if_dim_register:NT", token_if_cmd, subtypes(tok_if_dim_code * 4 + l3_T_code));
+    lazy_primitive("token_if_int_register:NT", token_if_cmd, subtypes(tok_if_int_code * 4 + l3_T_code));
+    lazy_primitive("token_if_muskip_register:NT", token_if_cmd, subtypes(tok_if_muskip_code * 4 + l3_T_code));
+    lazy_primitive("token_if_skip_register:NT", token_if_cmd, subtypes(tok_if_skip_code * 4 + l3_T_code));
+    lazy_primitive("token_if_toks_register:NT", token_if_cmd, subtypes(tok_if_toks_code * 4 + l3_T_code));
+    lazy_primitive("token_if_primitive:NT", token_if_cmd, subtypes(tok_if_primitive_code * 4 + l3_T_code));
+    lazy_primitive("token_if_eq_catcode:NNF", token_if_cmd, subtypes(tok_eq_cat_code * 4 + l3_F_code));
+    lazy_primitive("token_if_eq_charcode:NNF", token_if_cmd, subtypes(tok_eq_char_code * 4 + l3_F_code));
+    lazy_primitive("token_if_eq_meaning:NNF", token_if_cmd, subtypes(tok_eq_meaning_code * 4 + l3_F_code));
+    lazy_primitive("token_if_macro:NF", token_if_cmd, subtypes(tok_if_macro_code * 4 + l3_F_code));
+    lazy_primitive("token_if_cs:NF", token_if_cmd, subtypes(tok_if_cs_code * 4 + l3_F_code));
+    lazy_primitive("token_if_expandable:NF", token_if_cmd, subtypes(tok_if_expandable_code * 4 + l3_F_code));
+    lazy_primitive("token_if_long_macro:NF", token_if_cmd, subtypes(tok_if_long_code * 4 + l3_F_code));
+    lazy_primitive("token_if_protected_macro:NF", token_if_cmd, subtypes(tok_if_prot_code * 4 + l3_F_code));
+    lazy_primitive("token_if_protected_long_macro:NF", token_if_cmd, subtypes(tok_if_longprot_code * 4 + l3_F_code));
+    lazy_primitive("token_if_chardef:NF", token_if_cmd, subtypes(tok_if_chardef_code * 4 + l3_F_code));
+    lazy_primitive("token_if_mathchardef:NF", token_if_cmd, subtypes(tok_if_mathchardef_code * 4 + l3_F_code));
+    lazy_primitive("token_if_dim_register:NF", token_if_cmd, subtypes(tok_if_dim_code * 4 + l3_F_code));
+    lazy_primitive("token_if_int_register:NF", token_if_cmd, subtypes(tok_if_int_code * 4 + l3_F_code));
+    lazy_primitive("token_if_muskip_register:NF", token_if_cmd, subtypes(tok_if_muskip_code * 4 + l3_F_code));
+    lazy_primitive("token_if_skip_register:NF", token_if_cmd, subtypes(tok_if_skip_code * 4 + l3_F_code));
+    lazy_primitive("token_if_toks_register:NF", token_if_cmd, subtypes(tok_if_toks_code * 4 + l3_F_code));
+    lazy_primitive("token_if_primitive:NF", token_if_cmd, subtypes(tok_if_primitive_code * 4 + l3_F_code));
+    lazy_primitive("tl_new:N", tl_basic_cmd, l3_tl_new_code);
+    lazy_primitive("tl_clear:N", tl_basic_cmd, l3_tl_clear_code);
+    lazy_primitive("tl_gclear:N", tl_basic_cmd, l3_tl_gclear_code);
+    lazy_primitive("tl_const:Nn", tl_basic_cmd, l3_tl_const_code);
+    lazy_primitive("tl_const:Nx", tl_basic_cmd, l3_tl_xconst_code);
+    lazy_primitive("tl_clear_new:N", tl_basic_cmd, l3_tl_clearnew_code);
+    lazy_primitive("tl_gclear_new:N", tl_basic_cmd, l3_tl_gclearnew_code);
+    lazy_primitive("tl_new:c", tl_basic_cmd, l3_tlx_new_code);
+    lazy_primitive("tl_clear:c", tl_basic_cmd, l3_tlx_clear_code);
+    lazy_primitive("tl_gclear:c", tl_basic_cmd, l3_tlx_gclear_code);
+    lazy_primitive("tl_const:cn", tl_basic_cmd, l3_tlx_const_code);
+    lazy_primitive("tl_const:cx", tl_basic_cmd, l3_tlx_xconst_code);
+    lazy_primitive("tl_clear_new:c", tl_basic_cmd, l3_tlx_clearnew_code);
+    lazy_primitive("tl_gclear_new:c", tl_basic_cmd, l3_tlx_gclearnew_code);
+    lazy_primitive("tl_concat:NNN", tl_concat_cmd, zero_code);
+    lazy_primitive("tl_concat:ccc", tl_concat_cmd, one_code);
+    lazy_primitive("tl_gconcat:NNN", tl_concat_cmd, two_code);
+    lazy_primitive("tl_gconcat:ccc", tl_concat_cmd, three_code);
+    lazy_primitive("tl_set:Nn", tl_set_cmd, l3expn_code);
+    lazy_primitive("tl_set:No", tl_set_cmd, l3expo_code);
+    lazy_primitive("tl_set:Nf", tl_set_cmd, l3expf_code);
+    lazy_primitive("tl_set:Nx", tl_set_cmd, l3expx_code);
+    lazy_primitive("tl_set:NV", tl_set_cmd, l3expV_code);
+    lazy_primitive("tl_set:Nv", tl_set_cmd, l3expv_code);
+    lazy_primitive("tl_set:cn", tl_set_cmd, subtypes(l3expn_code + 9));
+    lazy_primitive("tl_set:co", tl_set_cmd, subtypes(l3expo_code + 9));
+    lazy_primitive("tl_set:cf", tl_set_cmd, subtypes(l3expf_code + 9));
+    lazy_primitive("tl_set:cx", tl_set_cmd, subtypes(l3expx_code + 9));
+    lazy_primitive("tl_set:cV", tl_set_cmd, subtypes(l3expV_code + 9));
+    lazy_primitive("tl_set:cv", tl_set_cmd, subtypes(l3expv_code + 9));
+    lazy_primitive("tl_gset:Nn", tl_set_cmd, subtypes(l3expn_code + 18));
+    lazy_primitive("tl_gset:No", tl_set_cmd, subtypes(l3expo_code + 18));
+    lazy_primitive("tl_gset:Nf", tl_set_cmd, subtypes(l3expf_code + 18));
+    lazy_primitive("tl_gset:Nx", tl_set_cmd, subtypes(l3expx_code + 18));
+    lazy_primitive("tl_gset:NV", tl_set_cmd, subtypes(l3expV_code + 18));
+    lazy_primitive("tl_gset:Nv", tl_set_cmd, subtypes(l3expv_code + 18));
+    lazy_primitive("tl_gset:cn", tl_set_cmd, subtypes(l3expn_code + 9 + 18));
+    lazy_primitive("tl_gset:co", tl_set_cmd, subtypes(l3expo_code + 9 + 18));
+    lazy_primitive("tl_gset:cf", tl_set_cmd, subtypes(l3expf_code + 9 + 18));
+    lazy_primitive("tl_gset:cx", tl_set_cmd, subtypes(l3expx_code + 9 + 18));
+    lazy_primitive("tl_gset:cV", tl_set_cmd, subtypes(l3expV_code + 9 + 18));
+    lazy_primitive("tl_gset:cv", tl_set_cmd, subtypes(l3expv_code + 9 + 18));
 
-    primitive("tl_put_left:Nn", tl_put_left_cmd, l3expn_code);
-    primitive("tl_put_left:No", tl_put_left_cmd, l3expo_code);
-    primitive("tl_put_left:Nx", tl_put_left_cmd, l3expx_code);
-    primitive("tl_put_left:NV", tl_put_left_cmd, l3expV_code);
-    primitive("tl_put_left:cn", tl_put_left_cmd, subtypes(l3expn_code + 9));
-    primitive("tl_put_left:co", tl_put_left_cmd, subtypes(l3expo_code + 9));
-    primitive("tl_put_left:cx", tl_put_left_cmd, subtypes(l3expx_code + 9));
-    primitive("tl_put_left:cV", tl_put_left_cmd, subtypes(l3expV_code + 9));
-    primitive("tl_gput_left:Nn", tl_put_left_cmd, subtypes(l3expn_code + 18));
-    primitive("tl_gput_left:No", tl_put_left_cmd, subtypes(l3expo_code + 18));
-    primitive("tl_gput_left:Nx", tl_put_left_cmd, subtypes(l3expx_code + 18));
-    primitive("tl_gput_left:NV", tl_put_left_cmd, subtypes(l3expV_code + 18));
-    primitive("tl_gput_left:cn", tl_put_left_cmd, subtypes(l3expn_code + 9 + 18));
-    primitive("tl_gput_left:co", tl_put_left_cmd, subtypes(l3expo_code + 9 + 18));
-    primitive("tl_gput_left:cx", tl_put_left_cmd, subtypes(l3expx_code + 9 + 18));
-    primitive("tl_gput_left:cV", tl_put_left_cmd, subtypes(l3expV_code + 9 + 18));
-    primitive("tl_put_right:Nn", tl_put_left_cmd, subtypes(l3expn_code + 36));
-    primitive("tl_put_right:No", tl_put_left_cmd, subtypes(l3expo_code + 36));
-    primitive("tl_put_right:Nx", tl_put_left_cmd, subtypes(l3expx_code + 36));
-    primitive("tl_put_right:NV", tl_put_left_cmd, subtypes(l3expV_code + 36));
-    primitive("tl_put_right:cn", tl_put_left_cmd, subtypes(l3expn_code + 9 + 36));
-    primitive("tl_put_right:co", tl_put_left_cmd, subtypes(l3expo_code + 9 + 36));
-    primitive("tl_put_right:cx", tl_put_left_cmd, subtypes(l3expx_code + 9 + 36));
-    primitive("tl_put_right:cV", tl_put_left_cmd, subtypes(l3expV_code + 9 + 36));
-    primitive("tl_gput_right:Nn", tl_put_left_cmd, subtypes(l3expn_code + 18 + 36));
-    primitive("tl_gput_right:No", tl_put_left_cmd, subtypes(l3expo_code + 18 + 36));
-    primitive("tl_gput_right:Nx", tl_put_left_cmd, subtypes(l3expx_code + 18 + 36));
-    primitive("tl_gput_right:NV", tl_put_left_cmd, subtypes(l3expV_code + 18 + 36));
-    primitive("tl_gput_right:cn", tl_put_left_cmd, subtypes(l3expn_code + 9 + 18 + 36));
-    primitive("tl_gput_right:co", tl_put_left_cmd, subtypes(l3expo_code + 9 + 18 + 36));
-    primitive("tl_gput_right:cx", tl_put_left_cmd, subtypes(l3expx_code + 9 + 18 + 36));
-    primitive("tl_gput_right:cV", tl_put_left_cmd, subtypes(l3expV_code + 9 + 18 + 36));
-    primitive("tl_set_rescan:Nnn", l3_rescan_cmd, subtypes(0));
-    primitive("tl_set_rescan:Nno", l3_rescan_cmd, subtypes(1));
-    primitive("tl_set_rescan:Nnx", l3_rescan_cmd, subtypes(2));
-    primitive("tl_set_rescan:cnn", l3_rescan_cmd, subtypes(3));
-    primitive("tl_set_rescan:cno", l3_rescan_cmd, subtypes(4));
-    primitive("tl_set_rescan:cnx", l3_rescan_cmd, subtypes(5));
-    primitive("tl_gset_rescan:Nnn", l3_rescan_cmd, subtypes(6));
-    primitive("tl_gset_rescan:Nno", l3_rescan_cmd, subtypes(7));
-    primitive("tl_gset_rescan:Nnx", l3_rescan_cmd, subtypes(8));
-    primitive("tl_gset_rescan:cnn", l3_rescan_cmd, subtypes(9));
-    primitive("tl_gset_rescan:cno", l3_rescan_cmd, subtypes(10));
-    primitive("tl_gset_rescan:cnx", l3_rescan_cmd, subtypes(11));
-    primitive("tl_rescan:nn", l3_rescan_cmd, subtypes(12));
-    primitive("tl_to_lowercase:n", case_shift_cmd, subtypes(6));
-    primitive("tl_to_uppercase:n", case_shift_cmd, subtypes(7));
+    lazy_primitive("tl_put_left:Nn", tl_put_left_cmd, l3expn_code);
+    lazy_primitive("tl_put_left:No", tl_put_left_cmd, l3expo_code);
+    lazy_primitive("tl_put_left:Nx", tl_put_left_cmd, l3expx_code);
+    lazy_primitive("tl_put_left:NV", tl_put_left_cmd, l3expV_code);
+    lazy_primitive("tl_put_left:cn", tl_put_left_cmd, subtypes(l3expn_code + 9));
+    lazy_primitive("tl_put_left:co", tl_put_left_cmd, subtypes(l3expo_code + 9));
+    lazy_primitive("tl_put_left:cx", tl_put_left_cmd, subtypes(l3expx_code + 9));
+    lazy_primitive("tl_put_left:cV", tl_put_left_cmd, subtypes(l3expV_code + 9));
+    lazy_primitive("tl_gput_left:Nn", tl_put_left_cmd, subtypes(l3expn_code + 18));
+    lazy_primitive("tl_gput_left:No", tl_put_left_cmd, subtypes(l3expo_code + 18));
+    lazy_primitive("tl_gput_left:Nx", tl_put_left_cmd, subtypes(l3expx_code + 18));
+    lazy_primitive("tl_gput_left:NV", tl_put_left_cmd, subtypes(l3expV_code + 18));
+    lazy_primitive("tl_gput_left:cn", tl_put_left_cmd, subtypes(l3expn_code + 9 + 18));
+    lazy_primitive("tl_gput_left:co", tl_put_left_cmd, subtypes(l3expo_code + 9 + 18));
+    lazy_primitive("tl_gput_left:cx", tl_put_left_cmd, subtypes(l3expx_code + 9 + 18));
+    lazy_primitive("tl_gput_left:cV", tl_put_left_cmd, subtypes(l3expV_code + 9 + 18));
+    lazy_primitive("tl_put_right:Nn", tl_put_left_cmd, subtypes(l3expn_code + 36));
+    lazy_primitive("tl_put_right:No", tl_put_left_cmd, subtypes(l3expo_code + 36));
+    lazy_primitive("tl_put_right:Nx", tl_put_left_cmd, subtypes(l3expx_code + 36));
+    lazy_primitive("tl_put_right:NV", tl_put_left_cmd, subtypes(l3expV_code + 36));
+    lazy_primitive("tl_put_right:cn", tl_put_left_cmd, subtypes(l3expn_code + 9 + 36));
+    lazy_primitive("tl_put_right:co", tl_put_left_cmd, subtypes(l3expo_code + 9 + 36));
+    lazy_primitive("tl_put_right:cx", tl_put_left_cmd, subtypes(l3expx_code + 9 + 36));
+    lazy_primitive("tl_put_right:cV", tl_put_left_cmd, subtypes(l3expV_code + 9 + 36));
+    lazy_primitive("tl_gput_right:Nn", tl_put_left_cmd, subtypes(l3expn_code + 18 + 36));
+    lazy_primitive("tl_gput_right:No", tl_put_left_cmd, subtypes(l3expo_code + 18 + 36));
+    lazy_primitive("tl_gput_right:Nx", tl_put_left_cmd, subtypes(l3expx_code + 18 + 36));
+    lazy_primitive("tl_gput_right:NV", tl_put_left_cmd, subtypes(l3expV_code + 18 + 36));
+    lazy_primitive("tl_gput_right:cn", tl_put_left_cmd, subtypes(l3expn_code + 9 + 18 + 36));
+    lazy_primitive("tl_gput_right:co", tl_put_left_cmd, subtypes(l3expo_code + 9 + 18 + 36));
+    lazy_primitive("tl_gput_right:cx", tl_put_left_cmd, subtypes(l3expx_code + 9 + 18 + 36));
+    lazy_primitive("tl_gput_right:cV", tl_put_left_cmd, subtypes(l3expV_code + 9 + 18 + 36));
+    lazy_primitive("tl_set_rescan:Nnn", l3_rescan_cmd, subtypes(0));
+    lazy_primitive("tl_set_rescan:Nno", l3_rescan_cmd, subtypes(1));
+    lazy_primitive("tl_set_rescan:Nnx", l3_rescan_cmd, subtypes(2));
+    lazy_primitive("tl_set_rescan:cnn", l3_rescan_cmd, subtypes(3));
+    lazy_primitive("tl_set_rescan:cno", l3_rescan_cmd, subtypes(4));
+    lazy_primitive("tl_set_rescan:cnx", l3_rescan_cmd, subtypes(5));
+    lazy_primitive("tl_gset_rescan:Nnn", l3_rescan_cmd, subtypes(6));
+    lazy_primitive("tl_gset_rescan:Nno", l3_rescan_cmd, subtypes(7));
+    lazy_primitive("tl_gset_rescan:Nnx", l3_rescan_cmd, subtypes(8));
+    lazy_primitive("tl_gset_rescan:cnn", l3_rescan_cmd, subtypes(9));
+    lazy_primitive("tl_gset_rescan:cno", l3_rescan_cmd, subtypes(10));
+    lazy_primitive("tl_gset_rescan:cnx", l3_rescan_cmd, subtypes(11));
+    lazy_primitive("tl_rescan:nn", l3_rescan_cmd, subtypes(12));
+    lazy_primitive("tl_to_lowercase:n", case_shift_cmd, subtypes(6));
+    lazy_primitive("tl_to_uppercase:n", case_shift_cmd, subtypes(7));
 }
 
 void Hashtab::boot_etex() {
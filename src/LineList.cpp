@@ -45,7 +45,7 @@ namespace {
 
         auto str = s.substr(a, b - a);
         S.push_back(str);
-        spdlog::trace("Defined type: {}", str);
+        Logger::trace("Defined type: {}", str);
     }
 
     // Returns 0, unless we see A="B", fills the buffers A and B.
@@ -85,7 +85,7 @@ void LineList::change_encoding(long wc) {
     if (wc >= 0 && wc < to_signed(max_encoding)) {
         encoding = to_unsigned(wc);
         Logger::finish_seq();
-        spdlog::trace("++ Input encoding changed to {} for {}", wc, file_name);
+        Logger::trace("++ Input encoding changed to {} for {}", wc, file_name);
     }
 }
 
@@ -454,7 +454,7 @@ void LineList::read(const std::string &x, int spec) { // \todo take a std::files
                     encoding = *k;
                     co_try   = 0;
                     Logger::finish_seq();
-                    spdlog::trace("++ Input encoding number {} detected  at line {} of file {}", *k, cur_line + 1, x);
+                    Logger::trace("++ Input encoding number {} detected  at line {} of file {}", *k, cur_line + 1, x);
                 }
             }
             if (converted) B.convert_line(cur_line + 1, encoding);
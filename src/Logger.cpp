@@ -5,7 +5,7 @@
 
 void Logger::log_dump(const std::string &s) {
     finish_seq();
-    spdlog::trace("{{\\{}}}", s);
+    Logger::trace("{{\\{}}}", s);
 }
 
 void Logger::log_finish() {
@@ -18,8 +18,28 @@ void Macro::correct_type() {
     }
 }
 
-// compares two macros
+// Computes the hash of nbargs, type, body and delimiters. This is done
+// when the macro is entered in the table; it must not be changed after.
+// Space and newline are the same for is_same, hence for the hash.
+void Macro::compute_hash() {
+    size_t h   = 14695981039346656037ULL; // FNV-1a
+    auto   add = [&h](size_t x) { h = (h ^ x) * 1099511628211ULL; };
+    auto   tok = [&add](Token t) { add(t.is_space_token() ? space_token_val : t.val); };
+    add(nbargs);
+    add(type);
+    for (auto t : body) tok(t);
+    for (const auto &L : delimiters) {
+        add(L.size());
+        for (auto t : L) tok(t);
+    }
+    hash = h == 0 ? 1 : h;
+}
+
+// compares two macros. Macros from the table have a hash, so that
+// different macros are in general rejected without looking at the tokens.
 auto Macro::is_same(const Macro &aux) const -> bool {
+    if (this == &aux) return true;
+    if (hash != 0 && aux.hash != 0 && hash != aux.hash) return false;
     if (nbargs != aux.nbargs) return false;
     if (type != aux.type) return false;
     if (!token_ns::compare(body, aux.body)) return false;
@@ -27,3 +47,9 @@ auto Macro::is_same(const Macro &aux) const -> bool {
         if (!token_ns::compare(delimiters[i], aux.delimiters[i])) return false;
     return true;
 }
+
+// Same as is_same, but space and newline tokens differ. Two identical
+// macros can share the same slot in the macro table.
+auto Macro::is_identical(const Macro &aux) const -> bool {
+    return hash == aux.hash && nbargs == aux.nbargs && type == aux.type && body == aux.body && delimiters == aux.delimiters;
+}
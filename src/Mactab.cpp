@@ -5,8 +5,19 @@
 // finds a slot for the macro
 // Note: the reference count is 0. This is strange: the macro has to
 // be killed or its reference count increased.
+// If an identical macro is in the table, s is killed and its slot is used.
 
 auto Mactab::mc_new_macro(Macro *s) -> size_t {
+    s->compute_hash();
+    auto [it, inserted] = by_hash.try_emplace(s->hash, size());
+    if (!inserted) {
+        auto k = it->second;
+        if (s->is_identical(*at(k).ptr)) {
+            delete s;
+            return k;
+        }
+        it->second = size();
+    }
     push_back({std::unique_ptr<Macro>(s), 0});
     return size() - 1;
 }
@@ -18,5 +29,8 @@ void Mactab::delete_macro_ref(size_t i) {
         abort();
     }
     at(i).ref--;
-    if (at(i).ref == 0) at(i).ptr.reset(); // \todo shared_ptr or something RAII?
+    if (at(i).ref != 0) return;
+    auto it = by_hash.find(at(i).ptr->hash);
+    if (it != by_hash.end() && it->second == i) by_hash.erase(it);
+    at(i).ptr.reset(); // \todo shared_ptr or something RAII?
 }
@@ -1,12 +1,16 @@
 #include "tralics/Bbl.h"
 #include "tralics/Bibtex.h"
 #include "tralics/Dispatcher.h"
+#include "tralics/EventTrace.h"
 #include "tralics/Line.h"
 #include "tralics/LineList.h"
 #include "tralics/Logger.h"
 #include "tralics/MathDataP.h"
+#include "tralics/MemoryStats.h"
 #include "tralics/NameMapper.h"
 #include "tralics/Parser.h"
+#include "tralics/PhaseTimer.h"
+#include "tralics/Profiler.h"
 #include "tralics/TitlePage.h"
 #include "tralics/TitlePageAux.h"
 #include "tralics/TitlePageFullLine.h"
@@ -38,6 +42,7 @@ source is the name of the source file,
 
 All options start with a single or double hyphen, they are:
   -verbose: Prints much more things in the log file
+  -trace: Writes trace messages in the .spdlog file
   -silent: Prints less information on the terminal
   -input_file FILE: translates file FILE
   -log_file LOG: uses LOG as transcript file
@@ -72,6 +77,11 @@ All options start with a single or double hyphen, they are:
   -doctype=A-B; specifies the XML DOCTYPE
   -usequotes: double quote gives two single quotes
   -shell-escape: enable \write18{SHELL COMMAND}
+  -profile: count and time expansions of macros and primitives
+  -trace_events: write timings of phases and input files in a .trace.json file
+  -memory_report: estimate the memory used by tokens, macros, XML, etc.
+  -trace_buffer: record \tracingmacros and \tracingcommands in a binary
+      .evt file, to be printed by tracedecode
   -tpa_status = title/all: translate all document or title only
   -default_class=xx: use xx.clt if current class is unknown
   -raw_bib: uses all bibtex fields
@@ -320,7 +330,7 @@ void MainClass::check_for_input() {
         spdlog::critical("Fatal error: Cannot open input file {}", infile);
         exit(1);
     }
-    spdlog::trace("Found input file: {}", *of);
+    Logger::trace("Found input file: {}", *of);
     s        = of->string();
     ult_name = of->replace_extension(".ult").string();
 
@@ -338,7 +348,7 @@ void MainClass::check_for_input() {
     auto wc = input_content.encoding;
     Logger::finish_seq();
     const std::string &wa = (wc == 0 ? "UTF-8" : wc == 1 ? "ISO-8859-1" : "custom");
-    spdlog::trace("++ Input encoding: {} ({}) for the main file", wc, wa);
+    Logger::trace("++ Input encoding: {} ({}) for the main file", wc, wa);
 }
 
 void MainClass::open_log() { // \todo spdlog etc
@@ -348,25 +358,28 @@ void MainClass::open_log() { // \todo spdlog etc
     if (log_encoding == en_boot) log_encoding = output_encoding;
 
     spdlog::info("Transcript written to {}", f);
-    spdlog::set_level(spdlog::level::trace);
+    spdlog::set_level(trace || verbose ? spdlog::level::trace : spdlog::level::debug);
     auto sink = std::make_shared<spdlog::sinks::basic_file_sink_st>(f.replace_extension("spdlog").string(), true);
     spdlog::default_logger()->sinks().push_back(sink);
     spdlog::default_logger()->sinks()[0]->set_level(spdlog::level::info); // \todo Link this with verbose (later in startup)
 
-    spdlog::trace("Transcript file of tralics {} for file {}", tralics_version, infile);
-    spdlog::trace("Copyright INRIA/MIAOU/APICS/MARELLE 2002-2015, Jos\\'e Grimm");
-    spdlog::trace("Tralics is licensed under the CeCILL Free Software Licensing Agreement");
-    spdlog::trace("OS: {} running on {}", print_os(cur_os), machine);
-    spdlog::trace("Output encoding: {}", print_enc(output_encoding));
-    spdlog::trace("Transcript encoding: {}", print_enc(log_encoding));
-    spdlog::trace("Left quote is '{}', right quote is '{}'", to_utf8(char32_t(leftquote_val)), to_utf8(char32_t(rightquote_val)));
-    if (trivial_math != 0) spdlog::trace("\\notrivialmath={}", trivial_math);
-    if (!default_class.empty()) spdlog::trace("Default class is {}", default_class);
+    Logger::trace("Transcript file of tralics {} for file {}", tralics_version, infile);
+    Logger::trace("Copyright INRIA/MIAOU/APICS/MARELLE 2002-2015, Jos\\'e Grimm");
+    Logger::trace("Tralics is licensed under the CeCILL Free Software Licensing Agreement");
+    Logger::trace("OS: {} running on {}", print_os(cur_os), machine);
+    Logger::trace("Output encoding: {}", print_enc(output_encoding));
+    Logger::trace("Transcript encoding: {}", print_enc(log_encoding));
+    Logger::trace("Left quote is '{}', right quote is '{}'", [] { return to_utf8(char32_t(leftquote_val)); },
+                  [] { return to_utf8(char32_t(rightquote_val)); });
+    if (trivial_math != 0) Logger::trace("\\notrivialmath={}", trivial_math);
+    if (!default_class.empty()) Logger::trace("Default class is {}", default_class);
     if (input_path.size() > 1) {
-        std::vector<std::string> tmp;
-        tmp.reserve(input_path.size());
-        std::copy(input_path.begin(), input_path.end(), std::back_inserter(tmp));
-        spdlog::trace("Input path: ({})", fmt::format("{}", fmt::join(tmp, ",")));
+        Logger::trace("Input path: ({})", [] {
+            std::vector<std::string> tmp;
+            tmp.reserve(input_path.size());
+            std::copy(input_path.begin(), input_path.end(), std::back_inserter(tmp));
+            return fmt::format("{}", fmt::join(tmp, ","));
+        });
     }
 
     spdlog::info("Starting translation of file {}", infile);
@@ -490,6 +503,10 @@ void MainClass::parse_option(int &p, int argc, char **argv) {
         verbose = true;
         return;
     }
+    if (s == "trace") {
+        trace = true;
+        return;
+    }
     if ((s == "V") || (s == "verbose-doc")) {
         dverbose = true;
         return;
@@ -587,6 +604,22 @@ void MainClass::parse_option(int &p, int argc, char **argv) {
         no_zerowidthelt = true;
         return;
     }
+    if (s == "profile") {
+        profiler.enabled = true;
+        return;
+    }
+    if (s == "traceevents") {
+        phase_timer.files = true;
+        return;
+    }
+    if (s == "tracebuffer") {
+        event_trace.enabled = true;
+        return;
+    }
+    if (s == "memoryreport") {
+        memory_report = true;
+        return;
+    }
     if (s == "shellescape") {
         shell_escape_allowed = true;
         return;
@@ -685,7 +718,7 @@ void MainClass::set_tpa_status(const std::string &s) { // \todo Erk this is not
 auto MainClass::check_for_tcf(const std::string &s) -> bool {
     std::string tmp = s + ".tcf";
     if (auto of = find_in_confdir(tmp); of) {
-        spdlog::trace("Found TCF file: {}", *of);
+        Logger::trace("Found TCF file: {}", *of);
         tcf_file = of;
         return true;
     }
@@ -734,24 +767,24 @@ void MainClass::open_config_file(std::filesystem::path f) {
             break;
         }
     }
-    spdlog::trace("Using tcf type {}", dtype);
+    Logger::trace("Using tcf type {}", dtype);
 }
 
 void MainClass::get_type_from_config() {
     dtype = config_file.find_top_val("Type", true);
     if (dtype.empty())
-        spdlog::trace("No type in configuration file");
+        Logger::trace("No type in configuration file");
     else
-        spdlog::trace("Configuration file has type {}", dtype);
+        Logger::trace("Configuration file has type {}", dtype);
     if (dtype.starts_with("\\documentclass")) dtype = "";
 }
 
 void MainClass::get_doc_type() {
     get_type_from_config();
     if (dclass.empty())
-        spdlog::trace("No \\documentclass in source file");
+        Logger::trace("No \\documentclass in source file");
     else
-        spdlog::trace("Seen \\documentclass {}", dclass);
+        Logger::trace("Seen \\documentclass {}", dclass);
     if (!type_option.empty())
         dtype = type_option;
     else if (dtype.empty()) {
@@ -762,7 +795,7 @@ void MainClass::get_doc_type() {
             return; // dft is 3
     }
     if (dtype.empty()) dtype = "unknown";
-    spdlog::trace("Potential type is {}", dtype);
+    Logger::trace("Potential type is {}", dtype);
 }
 
 auto MainClass::check_for_alias_type(bool vb) -> bool {
@@ -829,9 +862,9 @@ void MainClass::read_config_and_other() {
         bool found_type = find_document_type();
         if (dtype.empty()) found_type = false;
         if (found_type)
-            spdlog::trace("Using type {}", dtype);
+            Logger::trace("Using type {}", dtype);
         else
-            spdlog::trace("Using some default type");
+            Logger::trace("Using some default type");
         if (tcf_file) {
         } // config says to use a tcf
         else if (found_type)
@@ -872,7 +905,7 @@ void MainClass::see_name(std::filesystem::path s) {
 }
 
 void MainClass::trans0() {
-    spdlog::trace("Starting translation");
+    Logger::trace("Starting translation");
     the_parser.init_all(dtd);
     if (multi_math_label) the_parser.word_define(multimlabel_code, 1, false);
     if (nomathml) the_parser.word_define(nomath_code, -1, false);
@@ -893,9 +926,9 @@ void MainClass::boot_bibtex() {
 void MainClass::show_input_size() {
     int n = input_content.back().number;
     if (n == 1)
-        spdlog::trace("There is a single line");
+        Logger::trace("There is a single line");
     else
-        spdlog::trace("There are {} lines", n);
+        Logger::trace("There are {} lines", n);
 }
 
 void MainClass::more_boot() const {
@@ -914,22 +947,30 @@ void MainClass::more_boot() const {
 
 void MainClass::run(int argc, char **argv) {
     get_os();
+    phase_timer.start_phase("parse_args");
     parse_args(argc, argv); // look at arguments
-    more_boot();            // finish bootstrap
-    check_for_input();      // open the input file
+    phase_timer.start_phase("more_boot");
+    more_boot(); // finish bootstrap
+    phase_timer.start_phase("check_for_input");
+    check_for_input(); // open the input file
 
     dclass = input_content.find_documentclass();
     if (opt_doctype.empty()) opt_doctype = input_content.find_doctype();
 
+    phase_timer.start_phase("read_config_and_other");
     read_config_and_other();
-    spdlog::trace("OK with the configuration file, dealing with the TeX file...");
+    Logger::trace("OK with the configuration file, dealing with the TeX file...");
     show_input_size();
+    phase_timer.start_phase("boot_bibtex");
     boot_bibtex();
+    phase_timer.start_phase("translate_all");
     trans0();
     the_parser.init(input_content);
     the_parser.translate_all();
+    phase_timer.start_phase("after_main_text");
     the_parser.after_main_text();
     if (seen_enddocument) the_stack.add_nl();
+    phase_timer.start_phase("final_checks");
     the_parser.final_checks();
     if (!no_xml) {
         if (the_parser.get_list_files()) {
@@ -937,9 +978,19 @@ void MainClass::run(int argc, char **argv) {
             log_and_tty << file_list;
             log_and_tty << " ***********\n";
         }
+        math_data.dump_formula_cache();
         if (bad_chars != 0) spdlog::warn("Input conversion errors: {} char{}.", bad_chars, bad_chars > 1 ? "s" : "");
+        phase_timer.start_phase("finish_images");
         the_parser.finish_images();
+        if (profiler.enabled) {
+            profiler.finish();
+            profiler.report(out_dir / (log_name + ".prof.csv"));
+        }
+        if (event_trace.enabled) event_trace.dump(out_dir / (log_name + ".evt"));
+        phase_timer.start_phase("out_xml");
         out_xml();
+        if (memory_report) memory_ns::report({&input_content, &tex_source, &config_file, &from_config});
+        phase_timer.report(phase_timer.files ? out_dir / (log_name + ".trace.json") : std::filesystem::path());
         Logger::log_finish();
     } else
         spdlog::warn("Nothing written to {}.xml.", out_name);
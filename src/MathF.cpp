@@ -40,7 +40,7 @@ void MathF::push_in_t(Xml *x) {
     t->push_back_unless_nullptr(x);
 }
 
-void MathF::finish(std::list<MathElt> &value) {
+void MathF::finish(MathList &value) {
     if ((t != nullptr) && !t->all_empty()) the_parser.signal_error("internal bug in finish_translate");
     value.swap(res);
 }
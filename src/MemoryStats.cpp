@@ -0,0 +1,87 @@
+#include "tralics/MemoryStats.h"
+#include "tralics/Logger.h"
+#include "tralics/MathDataP.h"
+#include "tralics/Parser.h"
+#include "tralics/Stack.h"
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+namespace {
+    constexpr size_t list_node_overhead = 2 * sizeof(void *); // std::list links
+    constexpr size_t map_node_overhead  = 3 * sizeof(void *); // hash link, bucket and cached hash, approximately
+
+    // Heap bytes used by a string, beyond the object itself
+    auto heap_size(const std::string &s) -> size_t { return s.capacity() > 15 ? s.capacity() + 1 : 0; }
+
+    auto lines_size(const LineList &L, size_t &n) -> size_t {
+        size_t res = 0;
+        for (const auto &l : L) res += sizeof(Line) + list_node_overhead + heap_size(l);
+        n += L.size();
+        return res;
+    }
+
+    size_t total_bytes = 0;
+
+    void report_line(const std::string &what, size_t count, const std::string &detail, size_t bytes) {
+        total_bytes += bytes;
+        the_log << fmt::format("{:<20}{:>10}  {:<34}{:>12}\n", what, count, detail, bytes);
+    }
+} // namespace
+
+// Prints in the transcript the number and estimated size of the main objects.
+// Tokens are counted once, in the first line, even if they are in a macro body.
+// The argument holds the lines of the main file and configuration.
+void memory_ns::report(std::initializer_list<const LineList *> inputs) {
+    Logger::finish_seq();
+    the_log << fmt::format("{:<20}{:>10}  {:<34}{:>12}\n", "Memory report", "count", "", "bytes (est.)");
+
+    report_line("token nodes", token_nodes, fmt::format("peak {}, {} allocated", token_nodes_peak, token_allocs), token_nodes * (sizeof(Token) + list_node_overhead));
+
+    size_t nb_macros = 0, body = 0;
+    for (const auto &m : the_parser.mac_table) {
+        if (!m.ptr) continue;
+        ++nb_macros;
+        body += m.ptr->body.size();
+        for (size_t k = 0; k < 10; k++) body += (*m.ptr)[k].size();
+    }
+    report_line("macros", nb_macros, fmt::format("{} tokens in bodies", body),
+                the_parser.mac_table.capacity() * sizeof(rc_mac) + nb_macros * sizeof(Macro));
+
+    size_t names = 0;
+    for (const auto &s : hash_table) names += sizeof(std::string) + heap_size(s);
+    auto &map  = Hashtab::the_map();
+    auto &eqtb = Hashtab::the_eqtb();
+    for (const auto &x : map) names += sizeof(x) + map_node_overhead + heap_size(x.first);
+    names += eqtb.size() * (sizeof(std::pair<const size_t, EqtbCmdChr>) + map_node_overhead);
+    report_line("hash table", hash_table.size(), fmt::format("{} in map, {} in eqtb", map.size(), eqtb.size()), names);
+
+    // The stack has one attribute list and one element name per Xid
+    auto   nb_elts = the_stack.get_xid() + 1;
+    size_t nb_atts = 0, att_bytes = nb_elts * sizeof(AttList);
+    for (size_t k = 0; k < nb_elts; k++) {
+        const auto &A = the_stack.get_att_list(k);
+        nb_atts += A.size();
+        for (const auto &x : A) att_bytes += sizeof(x) + 4 * sizeof(void *) + heap_size(x.first) + heap_size(x.second);
+    }
+    report_line("attribute lists", nb_elts, fmt::format("{} pairs", nb_atts), att_bytes);
+
+    report_line("xml elements", nb_elts, "", nb_elts * (sizeof(Xml) + sizeof(Xml *)));
+    report_line("xml text nodes", xml_text_nodes, fmt::format("{} bytes of text", xml_text_bytes), xml_text_nodes * sizeof(Xml) + xml_text_bytes);
+
+    size_t math_elts = 0;
+    for (const auto &M : math_data) math_elts += M.size();
+    report_line("math lists", math_data.size(), fmt::format("{} elements", math_elts),
+                math_data.capacity() * sizeof(Math) + math_elts * (sizeof(MathElt) + list_node_overhead));
+
+    size_t pool_lines = 0, pool_bytes = 0;
+    for (const auto &L : file_pool) pool_bytes += sizeof(LineList) + lines_size(L, pool_lines);
+    report_line("file pool", file_pool.size(), fmt::format("{} lines", pool_lines), pool_bytes);
+
+    size_t nb_lines = 0, line_bytes = 0;
+    line_bytes += lines_size(the_parser.lines, nb_lines);
+    for (const auto *L : inputs) line_bytes += lines_size(*L, nb_lines);
+    report_line("input lines", nb_lines, "", line_bytes);
+
+    the_log << fmt::format("{:<66}{:>12}\n", "total", total_bytes);
+    spdlog::info("Memory report: about {} kB in the objects listed in the transcript.", total_bytes / 1024);
+}
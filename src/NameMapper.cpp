@@ -204,7 +204,7 @@ void NameMapper::boot() {
 }
 
 void NameMapper::assign(const std::string &sa, const std::string &sb) {
-    spdlog::trace("Assigning to `{}` the value \"{}\"", sa, sb);
+    Logger::trace("Assigning to `{}` the value \"{}\"", sa, sb);
     auto n = sa.size();
 
     if (sa.starts_with("elt_")) return the_names.assign_name(sa.substr(4), sb);
@@ -272,7 +272,7 @@ void NameMapper::assign(const std::string &sa, const std::string &sb) {
 }
 
 void NameMapper::assign_name(const std::string &A, const std::string &B) {
-    spdlog::trace("Setting XML element name `{}' to \"{}\" (assign_name)", A, B);
+    Logger::trace("Setting XML element name `{}' to \"{}\" (assign_name)", A, B);
 
     if (A == "pack_font_att") {
         if (B == "true") the_main.pack_font_elt = true;
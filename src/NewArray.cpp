@@ -275,7 +275,7 @@ void NewArray::ac_maybe_finish() {
         return;
     }
     if (last_ch_class == chc_cell || last_ch_class == chc_v || last_ch_class == chc_bar) {
-        AI->add_uv(u_list, v_list, attribs);
+        AI->add_uv(std::move(u_list), std::move(v_list), std::move(attribs));
         attribs.clear();
         u_list.clear();
         v_list.clear();
@@ -9,6 +9,7 @@
 #include "tralics/Logger.h"
 #include "tralics/NameMapper.h"
 #include "tralics/NewArray.h"
+#include "tralics/Profiler.h"
 #include "tralics/Saver.h"
 #include "tralics/Symcode.h"
 #include "tralics/globals.h"
@@ -987,7 +988,7 @@ namespace {
         Xml *res = new Xml(std::string("colorpool"), nullptr);
         for (auto &color : all_colors)
             if (color.used) {
-                res->push_back_unless_nullptr(&color.xval);
+                res->push_back_unless_nullptr(color.to_xml());
                 res->add_nl();
             }
         the_stack.document_element()->replace_first(res);
@@ -2398,11 +2399,13 @@ void Parser::start_a_cell(bool started) {
         Xid cid = the_stack.get_top_id();
         new_array_object.run(cid, false);
     } else {
-        TokenList L = the_stack.get_u_or_v(true);
-        if (tracing_commands() && !L.empty()) {
+        const auto &U = the_stack.get_u_or_v(true);
+        if (U.empty()) return;
+        if (tracing_commands()) {
             Logger::finish_seq();
-            the_log << "{template u-part " << L << "}\n";
+            the_log << "{template u-part " << U << "}\n";
         }
+        TokenList L = U;
         back_input(L);
     }
 }
@@ -2416,11 +2419,13 @@ void Parser::finish_a_cell(Token T, const std::string &a) {
     }
     back_input(T);
     if (the_stack.is_omit_cell()) return;
-    TokenList L = the_stack.get_u_or_v(false);
-    if (tracing_commands() && !L.empty()) {
+    const auto &V = the_stack.get_u_or_v(false);
+    if (V.empty()) return;
+    if (tracing_commands()) {
         Logger::finish_seq();
-        the_log << "{template v-part " << L << "}\n";
+        the_log << "{template v-part " << V << "}\n";
     }
+    TokenList L = V;
     back_input(L);
 }
 
@@ -2609,6 +2614,8 @@ void Parser::E_multispan() {
 [[nodiscard]] auto Parser::translate03() -> bool {
     auto guard  = SaveErrTok(cur_tok);
     auto [x, c] = cur_cmd_chr;
+    ProfileScope prof;
+    if (profiler.enabled) prof.start(cur_cmd_chr);
 
     if (x == underscore_catcode && global_in_load) return translate_char(cur_cmd_chr), true;
     if (auto res = Symcode::get(x).call(c)) return *res;
@@ -0,0 +1,88 @@
+#include "tralics/PhaseTimer.h"
+#include "tralics/Logger.h"
+#include "tralics/util.h"
+#include <chrono>
+#include <ctime>
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+namespace {
+    const auto time_origin = std::chrono::steady_clock::now();
+
+    auto json_string(const std::string &s) -> std::string {
+        std::string res = "\"";
+        for (auto c : s) {
+            if (c == '"' || c == '\\') res.push_back('\\');
+            if (static_cast<unsigned char>(c) < 32)
+                res += fmt::format("\\u{:04x}", int(c));
+            else
+                res.push_back(c);
+        }
+        res.push_back('"');
+        return res;
+    }
+} // namespace
+
+auto PhaseTimer::now() -> Sample {
+    Sample S;
+    S.wall_us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - time_origin).count();
+    S.cpu_us  = 1e6 * double(std::clock()) / CLOCKS_PER_SEC;
+#if !defined(_WIN32)
+    rusage R{};
+    getrusage(RUSAGE_SELF, &R);
+#if defined(__APPLE__)
+    S.rss_kb = R.ru_maxrss / 1024; // bytes on this system
+#else
+    S.rss_kb = R.ru_maxrss;
+#endif
+#endif
+    return S;
+}
+
+void PhaseTimer::begin(std::string name, std::string cat) { open.push_back({std::move(name), std::move(cat), now(), {}}); }
+
+// Ends the last span, provided that its category is cat
+void PhaseTimer::end(const std::string &cat) {
+    if (open.empty() || open.back().cat != cat) return;
+    auto S = std::move(open.back());
+    open.pop_back();
+    S.end = now();
+    spans.push_back(std::move(S));
+}
+
+// Finishes everything that is open, then starts the phase.
+void PhaseTimer::start_phase(std::string name) {
+    while (!open.empty()) end(open.back().cat);
+    begin(std::move(name), "phase");
+}
+
+// Puts the phases in the transcript; if p is not empty, writes all spans
+// as trace events in this file.
+void PhaseTimer::report(const std::filesystem::path &p) {
+    while (!open.empty()) end(open.back().cat);
+    Logger::finish_seq();
+    the_log << fmt::format("{:<24}{:>12}{:>12}{:>12}\n", "Phase", "wall (ms)", "cpu (ms)", "rss (kB)");
+    for (const auto &S : spans) {
+        if (S.cat != "phase") continue;
+        the_log << fmt::format("{:<24}{:>12.2f}{:>12.2f}{:>12}\n", S.name, (S.end.wall_us - S.start.wall_us) / 1000,
+                               (S.end.cpu_us - S.start.cpu_us) / 1000, S.end.rss_kb);
+    }
+    if (p.empty()) return;
+    auto fp = open_file(p.string(), true);
+    fp << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto &S : spans) {
+        if (!first) fp << ",";
+        first = false;
+        fp << fmt::format("\n{{\"name\":{},\"cat\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":{:.1f},\"dur\":{:.1f},"
+                          "\"args\":{{\"cpu_ms\":{:.2f},\"peak_rss_kb\":{}}}}}",
+                          json_string(S.name), S.cat, S.start.wall_us, S.end.wall_us - S.start.wall_us,
+                          (S.end.cpu_us - S.start.cpu_us) / 1000, S.end.rss_kb);
+    }
+    fp << "\n]}\n";
+    spdlog::info("Trace events written to {}", p.string());
+}
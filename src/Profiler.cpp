@@ -0,0 +1,152 @@
+#include "tralics/Profiler.h"
+#include "tralics/Logger.h"
+#include "tralics/util.h"
+#include <algorithm>
+#include <array>
+#include <fmt/format.h>
+#include <spdlog/spdlog.h>
+
+namespace {
+    constexpr size_t profile_top = 25; // number of lines in the transcript
+
+    struct ProfileRow {
+        std::string               kind, name;
+        size_t                    count;
+        Profiler::clock::duration incl, excl;
+    };
+
+    auto to_us(Profiler::clock::duration d) -> double { return std::chrono::duration<double, std::micro>(d).count(); }
+
+    // Name of a primitive; characters are named after their category code
+    auto primitive_name(symcodes cmd, subtypes chr) -> std::string {
+        static const std::array<String, 17> catcode_names{"escape", "begin-group", "end-group", "math shift", "alignment", "end-of-line",
+                                                          "parameter", "superscript", "subscript", "ignored", "space", "letter",
+                                                          "other", "active", "comment", "invalid", "shortverb"};
+        if (cmd <= special_catcode) return fmt::format("<{} character>", catcode_names[cmd]);
+        auto s = CmdChr(cmd, chr).name();
+        if (s.empty()) return fmt::format("<command {}>", size_t(cmd));
+        return "\\" + s;
+    }
+} // namespace
+
+auto Profiler::macro_entry(Token t) -> Entry & {
+    Entry *e = nullptr;
+    if (t.is_in_hash()) {
+        auto k = t.hash_loc();
+        if (k >= macros.size()) macros.resize(k + 1);
+        e = &macros[k];
+    } else
+        e = &char_macros[t.val];
+    e->tok = t;
+    return *e;
+}
+
+auto Profiler::primitive_entry(CmdChr x) -> Entry & {
+    auto &e = primitives[x.cmd];
+    if (e.count == 0) e.chr = x.chr;
+    return e;
+}
+
+void Profiler::push(CmdChr x) {
+    primitive_entry(x).active++;
+    frames.push_back({x.cmd, clock::now()});
+}
+
+void Profiler::open_macro(Token t) {
+    macro_entry(t).active++;
+    macro_frames.push_back({{t.val, clock::now()}, level, no_base});
+}
+
+// Called when the body of the macro is pushed in front of n tokens. The
+// macros whose body has been read are closed first; they ended when the
+// name of this one was read. While this is done, the current macro does
+// not count as active, so that the inclusive time of a tail recursive
+// macro is that of all its calls.
+void Profiler::body_start(size_t n) {
+    auto f = macro_frames.back();
+    macro_frames.pop_back();
+    auto &e = macro_entry(Token(f.key));
+    e.active--;
+    while (!macro_frames.empty()) {
+        const auto &g = macro_frames.back();
+        if (g.level != level || n > g.base) break;
+        pop_macro(f.start);
+    }
+    e.active++;
+    f.base = n;
+    macro_frames.push_back(f);
+}
+
+namespace {
+    // Adds the time of the last frame of V, that ends at t, to the entry e,
+    // and to the child time of the enclosing frame.
+    template <typename F> void close_frame(std::vector<F> &V, Profiler::Entry &e, Profiler::clock::time_point t) {
+        auto f = V.back();
+        V.pop_back();
+        auto d = t - f.start;
+        e.count++;
+        if (--e.active == 0) e.incl += d;
+        e.excl += d - f.child;
+        if (!V.empty()) V.back().child += d;
+    }
+} // namespace
+
+// Called at the end of translate03.
+void Profiler::pop() { close_frame(frames, primitives[frames.back().key], clock::now()); }
+
+// Called when the body of a macro has been read.
+void Profiler::pop_macro(clock::time_point t) { close_frame(macro_frames, macro_entry(Token(macro_frames.back().key)), t); }
+
+// Called after expand_mac. If no body was pushed (error, empty macro)
+// the expansion is over.
+void Profiler::body_end() {
+    if (macro_frames.back().base == no_base) pop_macro();
+}
+
+// Called when the current token list is abandoned; the macros whose body
+// is in it are over.
+void Profiler::leave_list() {
+    while (!macro_frames.empty() && macro_frames.back().level == level) pop_macro();
+    --level;
+}
+
+// Called at the end of the run; closes the macros still active, for
+// instance those that contain \end{document}.
+void Profiler::finish() {
+    while (!macro_frames.empty()) pop_macro();
+}
+
+// Prints the most expensive entries in the transcript, and all of them
+// as CSV in the file p.
+void Profiler::report(const std::filesystem::path &p) const {
+    std::vector<ProfileRow> rows;
+    auto add_macro = [&rows](const Entry &e) {
+        if (e.count != 0) rows.push_back({"macro", e.tok.tok_to_str(), e.count, e.incl, e.excl});
+    };
+    for (const auto &e : macros) add_macro(e);
+    for (const auto &x : char_macros) add_macro(x.second);
+    for (size_t i = 0; i < primitives.size(); i++) {
+        const auto &e = primitives[i];
+        if (e.count != 0) rows.push_back({"primitive", primitive_name(symcodes(i), e.chr), e.count, e.incl, e.excl});
+    }
+    std::sort(rows.begin(), rows.end(), [](const auto &a, const auto &b) { return a.excl > b.excl; });
+
+    Logger::finish_seq();
+    the_log << fmt::format("Profile: {} entries, by exclusive time\n", rows.size());
+    the_log << fmt::format("{:>10} {:>12} {:>12}  {}\n", "count", "incl (us)", "excl (us)", "name");
+    for (size_t i = 0; i < rows.size() && i < profile_top; i++) {
+        const auto &r = rows[i];
+        the_log << fmt::format("{:>10} {:>12.0f} {:>12.0f}  {} ({})\n", r.count, to_us(r.incl), to_us(r.excl), r.name, r.kind);
+    }
+    auto fp = open_file(p.string(), true);
+    fp << "kind,name,count,incl_us,excl_us\n";
+    for (const auto &r : rows) {
+        std::string name;
+        for (auto c : r.name) {
+            if (c == '"') name.push_back('"');
+            name.push_back(c);
+        }
+        fp << fmt::format("{},\"{}\",{},{:.1f},{:.1f}\n", r.kind, name, r.count, to_us(r.incl), to_us(r.excl));
+    }
+    spdlog::info("Profile written to {}", p.string());
+}
@@ -39,8 +39,9 @@ SaveAuxBoxend::~SaveAuxBoxend() {
 
 // This done when we restore an integer value
 SaveAuxInt::~SaveAuxInt() {
-    bool rt = eqtb_int_table[pos].level != 1;
-    if (rt) eqtb_int_table[pos] = {val, level};
+    auto &W  = eqtb_int(pos);
+    bool  rt = W.level != 1;
+    if (rt) W = {val, level};
 }
 
 // This done when we restore a string value
@@ -512,7 +512,7 @@ void Stack::delete_table_atts() {
     AI.pop_back();
 }
 
-auto Stack::get_u_or_v(bool u_or_v) -> TokenList {
+auto Stack::get_u_or_v(bool u_or_v) -> const TokenList & {
     Xid        unused;
     ArrayInfo *A       = get_my_table(unused);
     auto       cell_no = A->cell_no;
@@ -522,11 +522,11 @@ auto Stack::get_u_or_v(bool u_or_v) -> TokenList {
 // Adds positions attributes to the current cell, given the current
 // table info.
 void Stack::finish_cell(int w) {
-    Xid        cid;
-    ArrayInfo *A       = get_my_table(cid);
-    auto       cell_no = A->cell_no;
-    AttList    atts    = A->get_cell_atts(cell_no);
-    int        n       = 0;
+    Xid         cid;
+    ArrayInfo  *A       = get_my_table(cid);
+    auto        cell_no = A->cell_no;
+    const auto &atts    = A->get_cell_atts(cell_no);
+    int         n       = 0;
     if (auto a = fetch_att(cid, the_names["cols"])) {
         try {
             n = std::stoi(*a);
@@ -3,6 +3,7 @@
 #include "../tralics/Symcode.h"
 #include "../tralics/globals.h"
 #include "../tralics/util.h"
+#include <unordered_set>
 
 // Auto-registering package, see tipa.cpp for details
 
@@ -16,6 +17,26 @@ namespace {
     bool        xkv_is_global, xkv_is_save;
     std::string xkv_header, xkv_prefix;
 
+    // Token of a macro whose name depends on a family header. If the name
+    // is not in the hash table, known is false and stamp is the size of the
+    // table when this was checked; the entry is valid until the table grows.
+    struct CachedMacro {
+        Token  tok;
+        bool   known{false};
+        size_t stamp{0};
+
+        template <typename F> auto is_defined(F name) -> bool;
+    };
+
+    // For a header: the macros of the keys, those that hold the lists of
+    // saved and preset keys, and the header as a braced list.
+    struct FamMacros {
+        std::unordered_map<std::string, CachedMacro> keys;
+        CachedMacro                                  save, preseth, presett;
+        TokenList                                    header;
+    };
+    std::unordered_map<std::string, FamMacros> fam_macros;
+
     struct XkvToken {
         std::string keyname;
         TokenList   initial, value, action;
@@ -23,32 +44,37 @@ namespace {
 
     public:
         void extract();
-        void prepare(const std::string &fam);
+        void prepare(const TokenList &fam, const TokenList &header);
 
-        [[nodiscard]] auto check_save() const -> bool;
-        [[nodiscard]] auto is_defined(const std::string &fam) const -> bool;
+        [[nodiscard]] auto check_save(CachedMacro &save) const -> bool;
     };
 
     class XkvSetkeys {
-        std::vector<std::string> Fams;           // the list of all families
-        std::vector<std::string> Na;             // the list of keys not to set
-        std::vector<std::string> Keys;           // the list of keys
-        TokenList                fams;           // the list of families
-        TokenList                na;             // the list of keys that should not be set
-        TokenList                keyvals;        // the keylist to set
-        TokenList                delayed;        // unknown ketyvalue pairs
-        TokenList                action;         // expansion of \setkeys
-        bool                     no_err{false};  // Error when undefined ?
-        bool                     set_all{false}; // set key in all families ?
-        bool                     in_pox{false};  // are in in \ProcessOptionsX ?
+        std::vector<std::string>        Fams;           // the list of all families
+        std::vector<std::string>        headers;        // the headers of the families
+        std::vector<FamMacros *>        fam_data;       // the macros of the families
+        std::vector<TokenList>          fam_toks;       // the families, as braced lists
+        std::unordered_set<std::string> Na;             // the list of keys not to set
+        std::unordered_set<std::string> Keys;           // the list of keys
+        TokenList                       fams;           // the list of families
+        TokenList                       na;             // the list of keys that should not be set
+        TokenList                       keyvals;        // the keylist to set
+        TokenList                       delayed;        // unknown ketyvalue pairs
+        TokenList                       action;         // expansion of \setkeys
+        bool                            no_err{false};  // Error when undefined ?
+        bool                            set_all{false}; // set key in all families ?
+        bool                            in_pox{false};  // are in in \ProcessOptionsX ?
 
     public:
         void run(bool c);
-        void check_preset(String s);
+        void check_preset(int c);
+        void extract_fams();
+        auto header(size_t i) -> const std::string &;
+        auto is_defined(size_t i, const std::string &key) -> bool;
         void special_fams();
         void fetch_keys(bool c);
         void check_action(const XkvToken &cur);
-        void run_key(Token mac, XkvToken &cur, const std::string &fam);
+        void run_key(Token mac, XkvToken &cur, size_t i);
         void run_default(const std::string &Key, Token mac, bool s);
         void more_action(TokenList &L) { action.splice(action.end(), L); }
         void finish();
@@ -70,10 +96,28 @@ namespace {
         return res;
     }
 
-    [[nodiscard]] std::string xkv_makehd_s(const std::string &fam) {
+    [[nodiscard]] std::string xkv_makehd(const std::string &fam) {
         std::string res = xkv_prefix + fam;
         if (!fam.empty()) res.push_back('@');
-        xkv_header = res;
+        return res;
+    }
+
+    // Same as hash_table.is_defined(name()), but name() is called only if
+    // the token is not known.
+    template <typename F> auto CachedMacro::is_defined(F name) -> bool {
+        if (known) {
+            hash_table.last_tok = tok;
+            auto j              = Hashtab::the_eqtb().find(tok.eqtb_loc());
+            return j != Hashtab::the_eqtb().end() && !j->second.val.is_undef();
+        }
+        if (stamp == hash_table.size()) return false;
+        std::string s   = name();
+        bool        res = hash_table.is_defined(s);
+        if (Hashtab::the_map().count(s) != 0) {
+            tok   = hash_table.last_tok;
+            known = true;
+        } else if (!hash_table.lazy_latex3)
+            stamp = hash_table.size();
         return res;
     }
 
@@ -102,10 +146,11 @@ namespace {
                 xkv_is_global = true;
             }
         } else {
-            if (first == H.locate("savevalue")) {
+            static Token savevalue_token = H.locate("savevalue"), gsavevalue_token = H.locate("gsavevalue");
+            if (first == savevalue_token) {
                 x.pop_front();
                 xkv_is_save = true;
-            } else if (first == H.locate("gsavevalue")) {
+            } else if (first == gsavevalue_token) {
                 x.pop_front();
                 xkv_is_save   = true;
                 xkv_is_global = true;
@@ -117,8 +162,9 @@ namespace {
 
     // Interprets \usevalue{foo} in the list L
     void replace_pointers(TokenList &L) {
-        TokenList res;
-        int       n = 1000;
+        static Token usevalue_token = hash_table.locate("usevalue");
+        TokenList    res;
+        int          n = 1000;
         for (;;) {
             if (L.empty()) break;
             Token tt = L.front();
@@ -127,7 +173,7 @@ namespace {
                 continue;
             }
             L.pop_front();
-            if (tt != hash_table.locate("usevalue")) {
+            if (tt != usevalue_token) {
                 res.push_back(tt);
                 continue;
             }
@@ -173,8 +219,8 @@ namespace {
                 if (!cur.value.empty()) the_parser.parse_error(the_parser.err_tok, "No key for a value");
                 continue;
             }
-            if (std::find(Na.begin(), Na.end(), cur.keyname) != Na.end()) continue;
-            if (idx >= 0 && std::find(Keys.begin(), Keys.end(), cur.keyname) != Keys.end()) continue;
+            if (Na.count(cur.keyname) != 0) continue;
+            if (idx >= 0 && Keys.count(cur.keyname) != 0) continue;
             bool found = false;
             auto N     = Fams.size();
             // if idx>=0, execute the loop once
@@ -184,10 +230,10 @@ namespace {
                 N = to_unsigned(idx + 1);
             }
             for (; i < N; i++) {
-                if (!cur.is_defined(Fams[i])) continue;
+                if (!is_defined(i, cur.keyname)) continue;
                 Token T = hash_table.last_tok;
                 found   = true;
-                run_key(T, cur, Fams[i]);
+                run_key(T, cur, i);
                 if (!set_all) break;
             }
             if (!found) check_action(cur);
@@ -196,10 +242,22 @@ namespace {
 
     // This is called when the key is defined
     // What happens if you say \savevalue{keya} = \usevalue{keyb} ?
-    void XkvSetkeys::run_key(Token mac, XkvToken &cur, const std::string &fam) {
-        cur.prepare(fam);
+    // Here i is the index of the family, and xkv_header its header
+    void XkvSetkeys::run_key(Token mac, XkvToken &cur, size_t i) {
+        auto &F = *fam_data[i];
+        if (fam_toks[i].empty()) {
+            Buffer B{Fams[i]};
+            fam_toks[i] = B.str_toks11(false);
+            fam_toks[i].brace_me();
+        }
+        if (F.header.empty()) {
+            Buffer B{headers[i]};
+            F.header = B.str_toks11(false);
+            F.header.brace_me();
+        }
+        cur.prepare(fam_toks[i], F.header);
         more_action(cur.action);
-        bool               s   = cur.check_save();
+        bool               s   = cur.check_save(F.save);
         const std::string &Key = cur.keyname;
         TokenList          L   = cur.value;
         if (s) save_key(Key, L);
@@ -216,15 +274,17 @@ namespace {
 
     // Evaluate now everything
     void XkvSetkeys::finish() {
-        the_parser.new_macro(xkv_prefix, hash_table.locate("XKV@prefix"));
-        the_parser.new_macro(fams, hash_table.locate("XKV@fams"));
-        the_parser.new_macro(na, hash_table.locate("XKV@na"));
+        static Token prefix_token = hash_table.locate("XKV@prefix"), fams_token = hash_table.locate("XKV@fams"),
+                     na_token = hash_table.locate("XKV@na"), rm_token = hash_table.locate("XKV@rm");
+        the_parser.new_macro(xkv_prefix, prefix_token);
+        the_parser.new_macro(fams, fams_token);
+        the_parser.new_macro(na, na_token);
         if (!delayed.empty()) delayed.pop_back(); // remove trailing comma
         if (tracing_commands()) {
             Logger::finish_seq();
             the_log << "setkeys <- " << action << "\n";
         }
-        the_parser.new_macro(delayed, hash_table.locate("XKV@rm"));
+        the_parser.new_macro(delayed, rm_token);
         the_parser.back_input(action);
     }
 
@@ -243,13 +303,14 @@ namespace {
         token_ns::remove_first_last_space(value);
     }
 
-    void XkvSetkeys::check_preset(String s) {
+    // Here c is 1 for preseth, 2 for presett, see xkv_find_aux
+    void XkvSetkeys::check_preset(int c) {
         auto N = Fams.size();
         for (size_t i = 0; i < N; i++) {
-            auto xkv_local_buf = "XKV@" + xkv_makehd_s(Fams[i]) + s;
-            if (hash_table.is_defined(xkv_local_buf)) {
-                Token     T = hash_table.locate(xkv_local_buf);
-                TokenList W = the_parser.get_mac_value(T);
+            header(i);
+            auto &M = c == 1 ? fam_data[i]->preseth : fam_data[i]->presett;
+            if (M.is_defined([c] { return xkv_find_aux(c); })) {
+                TokenList W = the_parser.get_mac_value(hash_table.last_tok);
                 set_aux(W, to_signed(i));
             }
         }
@@ -859,7 +920,7 @@ namespace {
 
     // Extract the keys from a list, result in the vector R
     // Will store a normalised version of the list in L
-    void extract_keys(TokenList &L, std::vector<std::string> &R) {
+    template <typename C> void extract_keys(TokenList &L, C &R) {
         if (L.empty()) return;
         Token     T = hash_table.comma_token;
         TokenList res;
@@ -875,7 +936,7 @@ namespace {
                 token_ns::remove_first_last_space(z);
                 if (z.empty()) continue;
                 std::string s = xkv_find_key_of(z, 1);
-                R.push_back(s);
+                R.insert(R.end(), s);
                 res.splice(res.end(), z);
                 res.push_back(T);
             } else
@@ -886,15 +947,15 @@ namespace {
     }
 
     // Returns true if must be saved; may set xkv_is_global
-    auto XkvToken::check_save() const -> bool {
+    // The list of saved keys is in save, for the header xkv_header
+    auto XkvToken::check_save(CachedMacro &save) const -> bool {
         if (has_save) {
             xkv_is_global = is_global;
             return true;
         }
-        auto xkv_local_buf = xkv_find_aux(0);
-        if (!hash_table.is_defined(xkv_local_buf)) return false;
+        if (!save.is_defined([] { return xkv_find_aux(0); })) return false;
 
-        TokenList W = the_parser.get_mac_value(hash_table.locate(xkv_local_buf));
+        TokenList W = the_parser.get_mac_value(hash_table.last_tok);
         TokenList key;
         while (!W.empty()) {
             token_ns::split_at(hash_table.comma_token, W, key);
@@ -907,7 +968,7 @@ namespace {
     // Special case of ExecuteOptions
     void XkvSetkeys::special_fams() {
         fams = the_parser.XKV_parse_filename();
-        extract_keys(fams, Fams);
+        extract_fams();
     }
 
     void XkvSetkeys::fetch_keys(bool c) {
@@ -938,43 +999,58 @@ namespace {
             the_parser.new_macro(L, hash_table.locate("Gin@keys"));
             return;
         }
-        extract_keys(fams, Fams);
+        extract_fams();
         if (auto L = the_parser.read_optarg_nopar()) na.append(*L);
         extract_keys(na, Na);
         fetch_keys(c);
-        check_preset("preseth");
+        check_preset(1);
         set_aux(keyvals, -1);
-        check_preset("presett");
+        check_preset(2);
         finish();
     }
 
     // Constructs the header, in xkv_header
     // Constructs the 3 macros in action
-    void XkvToken::prepare(const std::string &fam) {
-        Hashtab &H = hash_table;
+    // The family and header are given as braced lists
+    void XkvToken::prepare(const TokenList &fam, const TokenList &header) {
+        Hashtab &    H          = hash_table;
+        static Token tkey_token = H.locate("XKV@tkey"), tfam_token = H.locate("XKV@tfam"), header_token = H.locate("XKV@header");
         // We start constructing the three macros
         action.push_back(H.def_token);
-        action.push_back(H.locate("XKV@tkey"));
+        action.push_back(tkey_token);
         Buffer    xkv_local_buf{keyname};
         TokenList L = xkv_local_buf.str_toks11(false);
         L.brace_me();
         action.splice(action.end(), L);
         action.push_back(H.def_token);
-        action.push_back(H.locate("XKV@tfam"));
-        xkv_local_buf = fam;
-        L             = xkv_local_buf.str_toks11(false);
-        L.brace_me();
-        action.splice(action.end(), L);
+        action.push_back(tfam_token);
+        action.insert(action.end(), fam.begin(), fam.end());
         action.push_back(H.def_token);
-        action.push_back(H.locate("XKV@header"));
-        xkv_local_buf = xkv_makehd_s(fam);
-        L             = xkv_local_buf.str_toks11(false);
-        L.brace_me();
-        action.splice(action.end(), L);
+        action.push_back(header_token);
+        action.insert(action.end(), header.begin(), header.end());
     }
 
-    // Returns true if the key is defined
-    auto XkvToken::is_defined(const std::string &fam) const -> bool { return hash_table.is_defined(xkv_makehd_s(fam) + keyname); }
+    // Computes the list of families, and their headers
+    void XkvSetkeys::extract_fams() {
+        extract_keys(fams, Fams);
+        for (const auto &fam : Fams) {
+            headers.push_back(xkv_makehd(fam));
+            fam_data.push_back(&fam_macros[headers.back()]);
+        }
+        fam_toks.resize(Fams.size()); // computed by run_key
+    }
+
+    // Header of family i, also in xkv_header
+    auto XkvSetkeys::header(size_t i) -> const std::string & {
+        xkv_header = headers[i];
+        return headers[i];
+    }
+
+    // True if the key is defined in family i, the token is in last_tok.
+    auto XkvSetkeys::is_defined(size_t i, const std::string &key) -> bool {
+        const auto &H = header(i);
+        return fam_data[i]->keys[key].is_defined([&H, &key] { return H + key; });
+    }
 
     void xkeyval() {
         hash_table.primitive_plain("define@boolkey", xkeyval_cmd, define_boolkey_code);
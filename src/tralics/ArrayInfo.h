@@ -14,7 +14,7 @@ public:
 
     explicit ArrayInfo(Xid a1) : id(a1) {}
 
-    [[nodiscard]] auto get_cell_atts(size_t k) const -> AttList;
-    [[nodiscard]] auto get_u_or_v(bool u_or_v, size_t pos) const -> TokenList;
-    void               add_uv(TokenList &u, TokenList &v, const AttList &At);
+    [[nodiscard]] auto get_cell_atts(size_t k) const -> const AttList &;
+    [[nodiscard]] auto get_u_or_v(bool u_or_v, size_t pos) const -> const TokenList &;
+    void               add_uv(TokenList &&u, TokenList &&v, AttList &&At);
 };
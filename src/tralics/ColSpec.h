@@ -1,6 +1,6 @@
 #pragma once
-#include "Xml.h"
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class Xml;
@@ -10,12 +10,12 @@ struct ColSpec {
     std::string model;
     std::string value;
     std::string id;
-    Xml         xval;
     bool        used{false};
 
     ColSpec(std::string a, std::string b, std::string c);
 
     [[nodiscard]] auto compare(const std::string &a, const std::string &b) const -> bool { return model == a && value == b; }
+    [[nodiscard]] auto to_xml() const -> Xml *;
 
     auto get_id() -> std::string { // \todo weird name
         used = true;
@@ -24,3 +24,7 @@ struct ColSpec {
 };
 
 inline std::vector<ColSpec> all_colors;
+
+// Position in all_colors of the first color with a given model and value;
+// the key is the model, a null character, and the value.
+inline std::unordered_map<std::string, size_t> color_index;
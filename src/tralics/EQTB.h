@@ -1,7 +1,9 @@
 #pragma once
 #include "enums.h"
 #include <array>
+#include <memory>
 #include <string>
+#include <vector>
 
 // Every eqtb entry has a level. Level_zero means undefined
 // Level_one is the outer level. The old value must be saved in case
@@ -19,10 +21,57 @@ using EqtbString = EQTB<std::string>;
 
 inline std::array<EqtbInt, integer_table_size> eqtb_int_table;
 
+// The \catcode, \mathcode, \lccode, \uccode, \sfcode and \delcode of
+// characters that do not fit in eqtb_int_table, from nb_characters to
+// nb_unicode. The code of c in table k (the offset divided by nb_characters)
+// is at position integer_table_size + k * nb_unicode + c. Pages are
+// allocated on first assignment, the others hold the initial values:
+// catcode 12, other codes zero.
+class AstralCodes {
+    static constexpr size_t page_size = 256;
+    using Page                        = std::array<EqtbInt, page_size>;
+    std::vector<std::unique_ptr<Page>> pages;
+
+    static auto initial(size_t i) -> EqtbInt { return {i < nb_unicode ? long(other_catcode) : 0, 1}; }
+
+public:
+    [[nodiscard]] auto get(size_t pos) const -> EqtbInt {
+        auto i = pos - integer_table_size;
+        auto k = i / page_size;
+        if (k < pages.size() && pages[k]) return (*pages[k])[i % page_size];
+        return initial(i);
+    }
+
+    auto operator[](size_t pos) -> EqtbInt & {
+        auto i = pos - integer_table_size;
+        auto k = i / page_size;
+        if (k >= pages.size()) pages.resize(k + 1);
+        if (!pages[k]) {
+            pages[k] = std::make_unique<Page>();
+            for (size_t j = 0; j < page_size; j++) (*pages[k])[j] = initial(k * page_size + j);
+        }
+        return (*pages[k])[i % page_size];
+    }
+};
+
+inline AstralCodes astral_codes;
+
+// Position of the code of character c in the table that starts at offset
+[[nodiscard]] inline auto char_code_pos(size_t offset, size_t c) -> size_t {
+    return c < nb_characters ? offset + c : integer_table_size + offset / nb_characters * nb_unicode + c;
+}
+// The integer at position a, in eqtb_int_table or astral_codes
+[[nodiscard]] inline auto eqtb_int(size_t a) -> EqtbInt & { return a < integer_table_size ? eqtb_int_table[a] : astral_codes[a]; }
+[[nodiscard]] inline auto eqtb_int_val(size_t a) -> long { return a < integer_table_size ? eqtb_int_table[a].val : astral_codes.get(a).val; }
+
 [[nodiscard]] inline auto cur_centering() -> size_t { return to_unsigned(eqtb_int_table[incentering_code].val); }
 [[nodiscard]] inline auto cur_lang_fr() -> bool { return eqtb_int_table[language_code].val == 1; }
 [[nodiscard]] inline auto cur_lang_german() -> bool { return eqtb_int_table[language_code].val == 2; }
-[[nodiscard]] inline auto get_catcode(size_t x) -> symcodes { return symcodes(eqtb_int_table[x].val); }
+[[nodiscard]] inline auto get_catcode(size_t x) -> symcodes {
+    if (x < nb_characters) return symcodes(eqtb_int_table[x].val);
+    if (x < nb_unicode) return symcodes(astral_codes.get(integer_table_size + x).val);
+    return other_catcode;
+}
 [[nodiscard]] inline auto is_pos_par(size_t k) { return eqtb_int_table[k].val > 0; }
 [[nodiscard]] inline auto tracing_assigns() -> bool { return is_pos_par(tracingassigns_code); }
 [[nodiscard]] inline auto tracing_io() -> bool { return is_pos_par(tracingoutput_code); }
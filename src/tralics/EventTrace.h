@@ -0,0 +1,54 @@
+#pragma once
+#include "Token.h"
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Macro;
+struct TokenList;
+
+// Binary tracer for the -trace_buffer option. When \tracingmacros or
+// \tracingcommands is positive, events are recorded in a ring buffer
+// instead of being formatted in the transcript; token lists go to a
+// second ring of token values. At the end of the run, the buffers are
+// written in a file that tools/tracedecode.cpp prints in the format of
+// the transcript. When the buffers are full, the oldest events are lost.
+struct EventTrace {
+    enum Kind : uint8_t { ev_macro, ev_argument, ev_command };
+
+    struct Event {
+        Kind     kind;
+        uint8_t  arg;  // argument number
+        uint32_t file; // index in files
+        uint32_t line;
+        uint32_t a, b;  // token and definition, or cmd and chr
+        uint64_t first; // position in the token ring of the argument
+        uint32_t len;
+    };
+
+    static constexpr size_t event_capacity = 1 << 18;
+    static constexpr size_t token_capacity = 1 << 20;
+
+    bool                                      enabled{false};
+    std::vector<Event>                        events;
+    std::vector<uint32_t>                     tokens;
+    uint64_t                                  nb_events{0}, nb_tokens{0}; // number recorded so far
+    std::vector<std::string>                  strings{""};                // file names and macro definitions
+    std::vector<uint32_t>                     definitions;                // indexed by macro slot, 0 if not yet seen
+    std::unordered_map<std::string, uint32_t> files;
+    std::string                               last_file;
+    uint32_t                                  last_file_id{0};
+
+    void macro(Token t, size_t slot, const Macro &X);
+    void argument(size_t i, const TokenList &L);
+    void command(CmdChr x);
+    void dump(const std::filesystem::path &p);
+
+private:
+    auto new_event(Kind k) -> Event &;
+    auto file_id() -> uint32_t;
+};
+
+inline EventTrace event_trace;
@@ -1,12 +1,28 @@
 #pragma once
+#include "FpNum.h"
 #include "TokenList.h"
+#include <vector>
 
-struct FpNum;
+// The stack of \FPupn. In the fp package, this is a comma-separated list
+// of tokens. Here each element is kept apart, and a number computed by an
+// operator is kept as an FpNum, so that it needs not be converted to
+// tokens and read again by the next operator.
+class FpStack {
+    struct Entry {
+        TokenList tokens;
+        FpNum     value;
+        bool      is_number{false};
+    };
+    std::vector<Entry> entries; // top of the stack is at the end
+
+    void pop_entry();
+    void push_tokens(TokenList L);
 
-class FpStack : public TokenList {
 public:
-    void pop_upn(FpNum &x);
-    void pop_upn(TokenList &L);
-    void push_upn(TokenList &L);
-    void push_upn(const FpNum &x);
+    [[nodiscard]] auto empty() const -> bool { return entries.empty(); }
+    void               clear() { entries.clear(); }
+    void               pop_upn(FpNum &x);
+    void               pop_upn(TokenList &L);
+    void               push_upn(TokenList &L);
+    void               push_upn(const FpNum &x);
 };
@@ -11,12 +11,16 @@ struct Hashtab : public std::vector<std::string> {
     static auto           the_eqtb() -> std::unordered_map<size_t, EqtbCmdChr> &;
     std::array<Token, 15> my_mathfont_table;
     std::array<Token, 5>  genfrac_mode;
+    bool                  lazy_latex3{false}; // some latex3 commands are defined on first use
+
+    std::unordered_map<std::string, CmdChr> lazy_primitives; // primitives created on first use
 
     Hashtab();
 
     auto locate(const std::string &s) -> Token;
     auto hash_find(const std::string &s) -> size_t;
     auto primitive(const std::string &s, symcodes c, subtypes v = zero_code) -> Token;
+    void lazy_primitive(const std::string &s, symcodes c, subtypes v = zero_code);
     auto primitive_plain(const std::string &s, symcodes c) -> Token;
     auto primitive_plain(const std::string &s, symcodes c, subtypes v) -> Token;
     auto primitive_and_action_plain(const std::string &s, const std::function<void()> &f, symcodes c) -> Token;
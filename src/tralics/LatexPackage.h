@@ -1,8 +1,37 @@
 #pragma once
 #include "KeyAndVal.h"
+#include <optional>
+#include <unordered_map>
 #include <vector>
 
-using OptionList = std::vector<KeyAndVal>; // \todo std::unordered_map? order relevant?
+// A list of options. Order is relevant, but classes may declare hundreds
+// of options, so that names are indexed: find returns the position of the
+// first option with the given name (or full name if X is false).
+class OptionList {
+    std::vector<KeyAndVal>                  items;
+    std::unordered_map<std::string, size_t> by_name, by_full_name;
+
+public:
+    void push_back(KeyAndVal x) {
+        by_name.try_emplace(x.name, items.size());
+        by_full_name.try_emplace(x.full_name, items.size());
+        items.push_back(std::move(x));
+    }
+    [[nodiscard]] auto find(const std::string &s, bool X) const -> std::optional<size_t> {
+        const auto &M  = X ? by_name : by_full_name;
+        auto        it = M.find(s);
+        if (it == M.end()) return {};
+        return it->second;
+    }
+    [[nodiscard]] auto size() const -> size_t { return items.size(); }
+    [[nodiscard]] auto empty() const -> bool { return items.empty(); }
+    auto               operator[](size_t i) -> KeyAndVal & { return items[i]; }
+    auto               operator[](size_t i) const -> const KeyAndVal & { return items[i]; }
+    auto               begin() { return items.begin(); }
+    auto               end() { return items.end(); }
+    [[nodiscard]] auto begin() const { return items.begin(); }
+    [[nodiscard]] auto end() const { return items.end(); }
+};
 
 // This defines what is in a package or a class
 class LatexPackage {
@@ -3,6 +3,13 @@
 #include <fstream>
 #include <memory>
 #include <spdlog/spdlog.h>
+#include <type_traits>
+
+// Trace messages go to the .spdlog file; configure with -DTRALICS_TRACE=OFF
+// to compile them out.
+#ifndef TRALICS_TRACE
+#define TRALICS_TRACE 1
+#endif
 
 inline Buffer        buffer_for_log2; // Only used out_single_char and finish_seq
 inline std::ofstream log_file;        // the stream to which we print
@@ -15,14 +22,39 @@ struct Logger {
     static void log_dump(const std::string &s); ///< Log argument surrounded by braces
     static void log_finish();                   // \todo This belongs in the destructor but spdlog could die first
 
-    static void out_single_char(char32_t c) { buffer_for_log2 << c; }
+    // True if a trace message would be written somewhere
+    static auto trace_on() -> bool {
+        if constexpr (TRALICS_TRACE == 0)
+            return false;
+        else
+            return spdlog::default_logger_raw()->should_log(spdlog::level::trace);
+    }
+
+    // Like spdlog::trace, but arguments that are callables are only evaluated
+    // if the message is logged, so that the caller does not pay for
+    // formatting or encoding conversion otherwise.
+    template <typename... Args> static void trace(const char *fmt, Args &&...args) {
+        if (trace_on()) spdlog::trace(fmt, lazy_arg(std::forward<Args>(args))...);
+    }
+
+    static void out_single_char(char32_t c) {
+        if (trace_on()) buffer_for_log2 << c;
+    }
 
     static void finish_seq() {
         if (!buffer_for_log2.empty()) {
-            spdlog::trace("Character sequence: {}.", buffer_for_log2.convert_to_log_encoding());
+            trace("Character sequence: {}.", [] { return buffer_for_log2.convert_to_log_encoding(); });
             buffer_for_log2.clear();
         }
     }
+
+private:
+    template <typename T> static auto lazy_arg(T &&x) -> decltype(auto) {
+        if constexpr (std::is_invocable_v<T>)
+            return x();
+        else
+            return std::forward<T>(x);
+    }
 };
 
 // By default, send things to the log file. In Logger, this defaulted to
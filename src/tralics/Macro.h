@@ -10,17 +10,20 @@ public:
     size_t    nbargs{0};       // number of arguments
     def_type  type{dt_normal}; // type of macro
     TokenList body;            // the body
+    size_t    hash{0};         // hash of the content, 0 if not computed, see compute_hash
 
     Macro() = default;
     explicit Macro(TokenList L) : body(std::move(L)) { correct_type(); }
 
     [[nodiscard]] auto is_same(const Macro &aux) const -> bool;
+    [[nodiscard]] auto is_identical(const Macro &aux) const -> bool;
     [[nodiscard]] auto operator[](size_t n) const -> const TokenList & { return delimiters[n]; }
 
     void set_nbargs(size_t n) { nbargs = n; } // \todo remove
     void set_type(def_type n) { type = n; }
     void set_delimiters(size_t k, TokenList L) { delimiters[k] = std::move(L); }
     void correct_type();
+    void compute_hash();
 };
 
 auto operator<<(std::ostream &fp, const Macro &x) -> std::ostream &;
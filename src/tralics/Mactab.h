@@ -1,6 +1,7 @@
 #pragma once
 #include "Macro.h"
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 struct rc_mac {
@@ -12,7 +13,11 @@ struct rc_mac {
 // Consider: \def\mac{\def\mac{a} b}. When mac is expanded, its body is copied
 // when the inner \def is executed, then \mac is destroyed (if nobody else
 // points to it, i.e. if the reference count is zero)
+// Identical macros share a slot: by_hash gives, for a hash value, the slot
+// of the last live macro entered with this hash.
 struct Mactab : std::vector<rc_mac> {
+    std::unordered_map<size_t, size_t> by_hash;
+
     void incr_macro_ref(size_t c) { at(c).ref++; }
     void delete_macro_ref(size_t i);
     auto get_macro(size_t k) -> Macro & { return *at(k).ptr; }
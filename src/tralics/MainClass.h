@@ -45,6 +45,7 @@ class MainClass {
     bool multi_math_label{false};
     bool load_l3{false};
     bool verbose{false}; ///< Are we verbose ?
+    bool trace{false};   ///< Do we write trace messages ?
 
 public:
     std::string default_class; ///< The default class
@@ -67,6 +68,7 @@ public:
     bool dverbose{false};         ///< Are we verbose at begin document ?
     bool footnote_hack{true};     ///< Not sure what this activates
     bool math_variant{false};
+    bool memory_report{false}; ///< Print a memory report at the end of the run
     bool no_entnames{false};
     bool no_undef_mac{false};
     bool no_xml{false}; ///< Are we in syntax-only mode (no XML output)?
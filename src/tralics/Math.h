@@ -9,9 +9,9 @@
 
 struct AttList;
 
-using const_math_iterator = std::list<MathElt>::const_iterator;
+using const_math_iterator = MathList::const_iterator;
 
-class Math : public std::list<MathElt> {
+class Math : public MathList {
     friend class MathDataP;
     friend class MathElt;
     math_list_type type{invalid_cd};
@@ -20,7 +20,7 @@ public:
     subtypes    sname{nomathenv_code};
     std::string saved;
 
-    using std::list<MathElt>::push_back;
+    using MathList::push_back;
 
     [[nodiscard]] auto        duplicate(bool nomath) const -> subtypes;
     auto                      chars_to_mb(Buffer &B, bool rec) const -> bool;
@@ -43,6 +43,7 @@ public:
     [[nodiscard]] auto        has_type(int x) const -> bool { return type == x; }
     void                      is_font_cmd1_list(const_math_iterator &B, const_math_iterator &E);
     auto                      M_array(bool numbered, math_style cms) -> Xml *;
+    auto                      cache_key(std::string &key) const -> bool;
     auto                      M_cv(math_style cms, int need_row) -> XmlAndType;
     void                      print() const;
     void                      push_back(CmdChr X, subtypes c, std::string s = "");
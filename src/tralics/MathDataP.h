@@ -1,6 +1,7 @@
 #pragma once
 #include "Math.h"
 #include <array>
+#include <unordered_map>
 
 // This is a global object for math handling
 class MathDataP : public std::vector<Math> {
@@ -16,12 +17,18 @@ class MathDataP : public std::vector<Math> {
     bool                                                  no_ent_names{};
     Token                                                 nomathsw0; // says next token is for nomathml only
     Token                                                 nomathsw1; // says next token is for normal mode only
+    std::unordered_map<std::string, Xml *>                formula_cache;      // translation of formulas already seen
+    size_t                                                formula_hits{}, formula_misses{}, formula_unshared{};
+    std::unordered_map<std::string, Xml *>                leaf_table;         // shared <mi> and <mn> elements
+    size_t                                                leaf_reused{};
+    bool                                                  share_leaves{};     // true while converting a shareable formula
 public:
     std::array<Xml *, last_math_loc> built_in_table_alt{}; // the static math table
 private:
     void boot_table();
     void boot2();
     void boot_chars();
+    void boot_symbols();
     void boot_xml_lr_tables();
     auto mk_gen(String name, String ent, String ent2, math_loc pos, math_loc pos2, const std::string &bl, symcodes t, bool hack) -> Token;
     void mk_ic(String name, String ent, String ent2, math_loc pos);
@@ -47,13 +54,17 @@ public:
     auto make_mfenced(size_t open, size_t close, gsl::not_null<Xml *> val) -> gsl::not_null<Xml *>;
     void TM_mk(String a, String b, math_types c);
     void finish_math_mem();
+    auto convert_shared(Math &u, math_style k) -> Xml *;
+    auto mk_leaf(const std::string &elt, const std::string &text, const std::string &variant) -> Xml *;
+    void dump_formula_cache() const;
     auto get_mc_table(size_t i) { return gsl::not_null{mc_table[i]}; }
     auto get_builtin(size_t p) { return gsl::not_null{built_in_table[p]}; }
     auto get_builtin_alt(size_t p) -> Xml * { return built_in_table_alt[p]; }
     void init_builtin(size_t i, Xml *X) { built_in_table[i] = X; }
     void init_builtin(size_t i, size_t j) { built_in_table[i] = built_in_table[j]; }
     void init_builtin(size_t i, Buffer &B) { built_in_table[i] = new Xml(B); }
-    auto get_xml_val(size_t i) -> Xml * {
+    static auto is_builtin(size_t i) -> bool { return i < m_offset; }
+    auto        get_xml_val(size_t i) -> Xml * {
         if (i < m_offset) return built_in_table[i];
         return xml_math_table[i - m_offset];
     }
@@ -1,16 +1,22 @@
 #pragma once
 #include "CmdChr.h"
-#include <utility>
+#include "PoolAllocator.h"
+#include <list>
+#include <string>
 
 class Xml;
 class Math;
 
 class MathElt : public CmdChr {
-    subtypes    font{};
-    std::string payload;
+    subtypes           font{};
+    const std::string *payload{&no_payload}; // interned, see intern_payload
+
+    static inline const std::string no_payload;
+    static auto                     intern_payload(std::string s) -> const std::string *;
 
 public:
-    MathElt(CmdChr X, subtypes c, std::string s = "") : CmdChr(X), font(c), payload(std::move(s)) {}
+    MathElt(CmdChr X, subtypes c) : CmdChr(X), font(c) {}
+    MathElt(CmdChr X, subtypes c, std::string s) : CmdChr(X), font(c), payload(intern_payload(std::move(s))) {}
     MathElt(subtypes a, math_types b) : CmdChr(math_xml_cmd, a), font(subtypes(b)) {}
     MathElt(Xml *x, math_types y);
     MathElt(Xml *A, long b, math_types c);
@@ -20,6 +26,7 @@ public:
     [[nodiscard]] auto get_font() const -> subtypes { return font; }
     [[nodiscard]] auto get_lcmd() const -> math_list_type { return math_list_type(font); }
     [[nodiscard]] auto get_list() const -> Math &;
+    [[nodiscard]] auto get_payload() const -> const std::string & { return *payload; }
     [[nodiscard]] auto get_xml_val() const -> Xml *;
     [[nodiscard]] auto get_xmltype() const -> math_types { return math_types(font); }
 
@@ -70,3 +77,7 @@ private:
     void               dump_for_err() const;
     [[nodiscard]] auto is_accent() const -> bool { return is_mathml() && font == 0; }
 };
+
+// Math lists are made of small nodes that are allocated and freed for each
+// formula; they are recycled by a pool.
+using MathList = std::list<MathElt, PoolAllocator<MathElt>>;
@@ -9,7 +9,7 @@ struct MathF {
     int                next_change{-1};
     int                next_finish{-1};
     MathQList          aux;
-    std::list<MathElt> res;
+    MathList           res;
     Xml *              t{};
 
     void change_state();
@@ -22,6 +22,6 @@ struct MathF {
         in_mrow = true;
         t_big   = false;
     }
-    void finish(std::list<MathElt> &value);
+    void finish(MathList &value);
     void pop_last(Xml *xval);
 };
@@ -0,0 +1,18 @@
+#pragma once
+#include <cstddef>
+#include <initializer_list>
+
+struct LineList;
+
+// Counters for the memory report of the -memory_report option. They are
+// updated by the constructors and allocators of the objects concerned;
+// the other figures of the report are computed at the end of the run.
+namespace memory_ns {
+    inline size_t token_nodes{0};      // live nodes of token lists
+    inline size_t token_nodes_peak{0}; // maximum of token_nodes
+    inline size_t token_allocs{0};     // number of nodes allocated so far
+    inline size_t xml_text_nodes{0};   // Xml text nodes created (Xml objects are never freed)
+    inline size_t xml_text_bytes{0};   // size of their initial content
+
+    void report(std::initializer_list<const LineList *> inputs);
+} // namespace memory_ns
@@ -129,6 +129,8 @@ struct Parser {
     void set_job_name(std::string s) { job_name = std::move(s); }
     void unexpected_font() { unexpected_seen_hi = true; }
     void L3_load(bool preload);
+    void L3_lazy_define(const std::string &s, Token T);
+    static auto L3_lazy_name(const std::string &s) -> bool;
 
     Parser();
 
@@ -138,6 +140,7 @@ struct Parser {
     void boot();
     void box_end(Xml *res, size_t pos);
     auto list_to_string0(Buffer &b) -> bool;
+    void name_chars_from_line(Buffer &b);
     auto list_to_string(TokenList &L, Buffer &b) -> bool;
     auto list_to_string_cv(TokenList &L, Buffer &b) -> bool;
     auto list_to_string_c(TokenList &x, const std::string &s1, const std::string &s2, const std::string &msg) -> Buffer;
@@ -152,6 +155,7 @@ struct Parser {
     void flush_buffer();
     void font_has_changed1();
     auto fp_read_value() -> FpNum;
+    auto fp_use_value(const FpNum &res) -> FpNum;
     void fp_send_one_arg(TokenList &res);
     void init_all(const std::string &doc_elt);
     void load_latex();
@@ -313,6 +317,7 @@ struct Parser {
     auto               scan_special_int_d(Token T, long d) -> long;
     auto               scan_style() -> Token;
     auto               scan_twenty_seven_bit_int() -> int;
+    auto               scan_unicode_num() -> size_t;
     auto               sE_arg_nopar() -> std::string;
     auto               sE_arg() -> std::string;
     auto               sE_optarg_nopar() -> std::string;
@@ -602,6 +607,7 @@ struct Parser {
     void               out_warning(Buffer &B, msg_type what);
     void               parshape_aux(subtypes m);
     void               pass_text(Token Tfe);
+    void               skip_inert_text();
     void               pop_all_levels();
     void               pop_input_stack(bool vb);
     void               pop_level(boundary_type v);
@@ -858,6 +864,7 @@ struct Parser {
     void               translate_char(CmdChr X);
     void               translate_char(uchar c1, uchar c2);
     void               translate_font_size();
+    void               translate_run();
     void               translate02() const;
     [[nodiscard]] auto translate03() -> bool;
     void               translate1();
@@ -884,8 +891,7 @@ struct Parser {
     auto l3_read_int(Token T) -> long;
     auto L3_split_next_name() -> bool;
     auto l3_to_string(subtypes c, TokenList &L) -> std::string;
-    void define_definer(String base, String nsig, String osig);
-    void define_definer(String base);
+    void define_definer(Token nt, const std::string &base, const std::string &sig);
     void E_cat_ifeq(subtypes c);
     void E_l3_ifx(subtypes c);
     void E_l3expand_aux(subtypes c);
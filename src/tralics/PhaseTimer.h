@@ -0,0 +1,32 @@
+#pragma once
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// Wall time, CPU time and peak memory of the phases of a run (see
+// MainClass::run), and optionally of each input file. The phases are
+// summarized in the transcript; with -trace_events, everything is also
+// written in Chrome trace-event format, viewable with chrome://tracing
+// or Perfetto.
+struct PhaseTimer {
+    struct Sample {
+        double wall_us{0}, cpu_us{0};
+        long   rss_kb{0}; // peak resident set size so far
+    };
+    struct Span {
+        std::string name, cat;
+        Sample      start, end;
+    };
+
+    bool              files{false}; // record input files as well
+    std::vector<Span> spans;        // finished, in order of completion
+    std::vector<Span> open;         // started, not finished
+
+    static auto now() -> Sample;
+    void        start_phase(std::string name);
+    void        begin(std::string name, std::string cat);
+    void        end(const std::string &cat);
+    void        report(const std::filesystem::path &p);
+};
+
+inline PhaseTimer phase_timer;
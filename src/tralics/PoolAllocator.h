@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// Free list of blocks of the given size, carved from chunks of contiguous
+// memory. Blocks are recycled but memory is never given back, so that the
+// pool can outlive the objects that use it.
+template <size_t Size, size_t Align> class NodePool {
+    union Node {
+        Node *next;
+        alignas(Align) std::byte data[Size];
+    };
+    static constexpr size_t chunk_size = 256;
+
+    Node *                               free_list{nullptr};
+    std::vector<std::unique_ptr<Node[]>> chunks;
+
+    void refill() {
+        chunks.emplace_back(new Node[chunk_size]);
+        for (size_t i = chunk_size; i > 0; i--) put(&chunks.back()[i - 1]);
+    }
+
+public:
+    static auto the_pool() -> NodePool & {
+        static auto *P = new NodePool; // never destroyed, see above
+        return *P;
+    }
+    auto get() -> void * {
+        if (free_list == nullptr) refill();
+        auto *p   = free_list;
+        free_list = p->next;
+        return p;
+    }
+    void put(void *p) {
+        auto *q   = static_cast<Node *>(p);
+        q->next   = free_list;
+        free_list = q;
+    }
+};
+
+// Allocator for node-based containers such as std::list: nodes come from
+// a NodePool, other requests use the standard allocator.
+template <typename T> struct PoolAllocator {
+    using value_type = T;
+    using pool       = NodePool<sizeof(T), alignof(T)>;
+
+    PoolAllocator() = default;
+    template <typename U> PoolAllocator(const PoolAllocator<U> & /*unused*/) {}
+
+    auto allocate(size_t n) -> T * {
+        if (n != 1) return std::allocator<T>{}.allocate(n);
+        return static_cast<T *>(pool::the_pool().get());
+    }
+    void deallocate(T *p, size_t n) {
+        if (n != 1)
+            std::allocator<T>{}.deallocate(p, n);
+        else
+            pool::the_pool().put(p);
+    }
+    friend auto operator==(const PoolAllocator & /*unused*/, const PoolAllocator & /*unused*/) -> bool { return true; }
+};
@@ -0,0 +1,96 @@
+#pragma once
+#include "Token.h"
+#include <chrono>
+#include <filesystem>
+#include <unordered_map>
+#include <vector>
+
+// Data for the -profile option. We count the expansions of user macros
+// and the primitives executed by translate03, with inclusive time and
+// exclusive time (inclusive time minus that of nested calls of the same
+// kind). Macros in the hash table use a flat array indexed by hash location.
+//
+// A primitive is timed while translate03 runs. A macro is timed from the
+// start of its expansion until the first token after its body is read, so
+// that the time includes the arguments and everything the body does. The
+// token list TL is swapped for a new one by \input and by SaveState; a
+// macro is closed only by reads in the list where its body was pushed,
+// or when that list is abandoned. As in TeX, a macro whose body has been
+// read is closed when the body of the next one is pushed, so that tail
+// recursion does not nest. The inclusive time of a recursive call is
+// counted only for the outermost one.
+struct Profiler {
+    using clock = std::chrono::steady_clock;
+
+    struct Entry {
+        size_t          count{0};
+        size_t          active{0}; // number of frames, for recursive calls
+        clock::duration incl{}, excl{};
+        Token           tok;           // for macros, the name
+        subtypes        chr{zero_code}; // for primitives, the first subtype seen
+    };
+
+    struct Frame {
+        size_t            key; // token value of a macro, command code of a primitive
+        clock::time_point start;
+        clock::duration   child{};
+    };
+
+    struct MacroFrame : Frame {
+        size_t level; // the list where the body is
+        size_t base;  // size of TL below the body, no_base while reading arguments
+    };
+
+    static constexpr size_t no_base = size_t(-1);
+
+    bool                              enabled{false};
+    std::vector<Entry>                macros;      // indexed by hash location
+    std::unordered_map<size_t, Entry> char_macros; // active characters and \x, by token value
+    std::vector<Entry>                primitives = std::vector<Entry>(eof_marker_cmd + 1);
+    std::vector<Frame>                frames;       // primitives being executed
+    std::vector<MacroFrame>           macro_frames; // macros whose body is not yet read
+    size_t                            level{0};     // number of saved token lists
+
+    auto macro_entry(Token t) -> Entry &;
+    auto primitive_entry(CmdChr x) -> Entry &;
+    void push(CmdChr x);
+    void pop();
+    void open_macro(Token t);
+    void body_start(size_t n);
+    void body_end();
+    void pop_macro(clock::time_point t = clock::now());
+    void enter_list() { ++level; }
+    void leave_list();
+    void finish();
+    void report(const std::filesystem::path &p) const;
+
+    // Called before a token is read, n is the size of TL. Closes the
+    // macros whose body has been read.
+    void before_token(size_t n) {
+        while (!macro_frames.empty()) {
+            const auto &f = macro_frames.back();
+            if (f.level != level || f.base == no_base || n > f.base) return;
+            pop_macro();
+        }
+    }
+};
+
+inline Profiler profiler;
+
+// Times the region where it is alive, once start has been called.
+class ProfileScope {
+    bool active{false};
+
+public:
+    ProfileScope() = default;
+    ProfileScope(const ProfileScope &) = delete;
+    auto operator=(const ProfileScope &) -> ProfileScope & = delete;
+    ~ProfileScope() {
+        if (active) profiler.pop();
+    }
+
+    void start(CmdChr x) {
+        profiler.push(x);
+        active = true;
+    }
+};
@@ -1,4 +1,5 @@
 #pragma once
+#include "Profiler.h"
 #include "TokenList.h"
 
 class SaveState {
@@ -11,8 +12,10 @@ public:
     SaveState(TokenList &LLL, bool &bbb) : LL(LLL), bb(bbb) {
         LL.swap(L);
         std::swap(bb, b);
+        if (profiler.enabled) profiler.enter_list();
     }
     ~SaveState() {
+        if (profiler.enabled) profiler.leave_list();
         LL.swap(L);
         std::swap(bb, b);
     }
@@ -37,6 +37,7 @@ public:
     [[nodiscard]] auto get_cur_par() const -> Xml *;
     [[nodiscard]] auto get_mode() const -> mode { return cur_mode; }
     [[nodiscard]] auto get_xid() const -> size_t { return enames.size() - 1; }
+    [[nodiscard]] auto is_boot_xid(Xid x) const -> bool { return x.value != 0 && x.value <= xid_boot; }
     [[nodiscard]] auto in_v_mode() const -> bool { return get_mode() == mode_v; }
     [[nodiscard]] auto in_h_mode() const -> bool { return get_mode() == mode_h; }
     [[nodiscard]] auto in_no_mode() const -> bool { return get_mode() == mode_none; }
@@ -77,7 +78,7 @@ public:
     void fonts0(const std::string &x);
     auto get_att_list(size_t k) -> AttList & { return attributes[k]; }
     auto get_my_table(Xid &cid) -> ArrayInfo *;
-    auto get_u_or_v(bool u_or_v) -> TokenList;
+    auto get_u_or_v(bool u_or_v) -> const TokenList &;
     void hack_for_hanl();
     void implement_cit(const std::string &b1, const std::string &b2, const std::string &a, const std::string &c);
     void init_all(const std::string &a);
@@ -11,14 +11,14 @@ struct Token {
     Token() = default;
 
     void kill() { val = 0; }
-    void from_cmd_chr(CmdChr X) { val = nb_characters * X.cmd + X.char_val(); }
+    void from_cmd_chr(CmdChr X) { val = nb_unicode * X.cmd + X.char_val(); }
     void active_char(size_t cs) { val = cs + eqtb_offset; }
 
     [[nodiscard]] auto active_or_single() const -> bool { return val < first_multitok_val; }
     [[nodiscard]] auto char_or_active() const -> bool { return val < single_offset; }
-    [[nodiscard]] auto char_val() const -> char32_t { return char32_t(val % nb_characters); }
-    [[nodiscard]] auto chr_val() const -> subtypes { return subtypes(val % nb_characters); }
-    [[nodiscard]] auto cmd_val() const -> symcodes { return symcodes(val / nb_characters); }
+    [[nodiscard]] auto char_val() const -> char32_t { return char32_t(val % nb_unicode); }
+    [[nodiscard]] auto chr_val() const -> subtypes { return subtypes(val % nb_unicode); }
+    [[nodiscard]] auto cmd_val() const -> symcodes { return symcodes(val / nb_unicode); }
     [[nodiscard]] auto eqtb_loc() const -> size_t { return val - eqtb_offset; }
     [[nodiscard]] auto hash_loc() const -> size_t { return val - hash_offset; }
     [[nodiscard]] auto is_a_brace() const -> bool { return OB_t_offset <= val && val < RB_limit; }
@@ -75,4 +75,4 @@ inline Token T_use1, T_use2, T_usen, T_use_nonen, T_exp_notN, T_exp_notn, T_empt
     Tc_true_bool, Tc_false_bool, cmd_name, token_to_split;
 inline std::array<Token, 20> special_double;
 
-inline auto make_char_token(unsigned char c, unsigned cat) -> Token { return Token(nb_characters * cat + c); }
+inline auto make_char_token(unsigned char c, unsigned cat) -> Token { return Token(nb_unicode * cat + c); }
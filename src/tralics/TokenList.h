@@ -1,9 +1,31 @@
 #pragma once
+#include "MemoryStats.h"
 #include "Token.h"
+#include <memory>
 
 struct Hashtab;
 
-struct TokenList : public std::list<Token> {
+// Allocator for the nodes of token lists, it counts them for the memory report
+template <typename T> struct TokenAllocator {
+    using value_type = T;
+
+    TokenAllocator() = default;
+    template <typename U> TokenAllocator(const TokenAllocator<U> & /*unused*/) {}
+
+    auto allocate(size_t n) -> T * {
+        memory_ns::token_nodes += n;
+        memory_ns::token_allocs += n;
+        if (memory_ns::token_nodes > memory_ns::token_nodes_peak) memory_ns::token_nodes_peak = memory_ns::token_nodes;
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T *p, size_t n) {
+        memory_ns::token_nodes -= n;
+        std::allocator<T>{}.deallocate(p, n);
+    }
+    friend auto operator==(const TokenAllocator & /*unused*/, const TokenAllocator & /*unused*/) -> bool { return true; }
+};
+
+struct TokenList : public std::list<Token, TokenAllocator<Token>> {
     [[nodiscard]] auto block_size() const -> int;
     [[nodiscard]] auto expand_mac_inner(TokenList *arguments) const -> TokenList;
 
@@ -0,0 +1,77 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// A validating UTF-8 decoder. Errors are reported by return values,
+// so that the caller decides how to warn and what to skip.
+
+namespace utf8_ns {
+    /// Length of a sequence given its first byte, 0 if the byte cannot start one.
+    /// This excludes C0 and C1 (overlong) and F5-FF (beyond U+10FFFF).
+    inline constexpr std::array<uint8_t, 256> seq_length = [] {
+        std::array<uint8_t, 256> t{};
+        for (unsigned c = 0; c < 256; ++c) {
+            if (c < 0x80)
+                t[c] = 1;
+            else if (c >= 0xC2 && c < 0xE0)
+                t[c] = 2;
+            else if (c >= 0xE0 && c < 0xF0)
+                t[c] = 3;
+            else if (c >= 0xF0 && c < 0xF5)
+                t[c] = 4;
+        }
+        return t;
+    }();
+
+    /// Decodes the character starting at position i in s, puts it in cp.
+    /// Returns the number of bytes used, 0 in case of error.
+    inline auto decode(std::string_view s, size_t i, char32_t &cp) -> size_t {
+        auto c = static_cast<uint8_t>(s[i]);
+        auto n = seq_length[c];
+        if (n == 1) {
+            cp = c;
+            return 1;
+        }
+        if (n == 0 || i + n > s.size()) return 0;
+        char32_t r = c & (0x7FU >> n);
+        for (size_t k = 1; k < n; ++k) {
+            auto d = static_cast<uint8_t>(s[i + k]);
+            if ((d & 0xC0U) != 0x80U) return 0;
+            r = (r << 6) | (d & 0x3FU);
+        }
+        static constexpr std::array<char32_t, 5> min_val{0, 0, 0x80, 0x800, 0x10000};
+        if (r < min_val[n] || r > 0x10FFFF || (r >= 0xD800 && r < 0xE000)) return 0; // overlong, too big, surrogate
+        cp = r;
+        return n;
+    }
+
+    /// Decodes s into res (which is cleared), stopping at a null byte.
+    /// An invalid byte is skipped; the position of the first one is put in bad,
+    /// and the number of errors is returned.
+    inline auto decode_line(std::string_view s, std::vector<char32_t> &res, size_t &bad) -> size_t {
+        res.clear();
+        res.reserve(s.size());
+        size_t errs = 0;
+        for (size_t i = 0; i < s.size();) {
+            auto c = static_cast<uint8_t>(s[i]);
+            if (c == 0) break;
+            if (c < 0x80) {
+                res.push_back(c);
+                ++i;
+                continue;
+            }
+            char32_t cp = 0;
+            if (auto n = decode(s, i, cp)) {
+                res.push_back(cp);
+                i += n;
+            } else {
+                if (errs == 0) bad = i;
+                ++errs;
+                ++i;
+            }
+        }
+        return errs;
+    }
+} // namespace utf8_ns
@@ -1,5 +1,6 @@
 #pragma once
 #include "Buffer.h"
+#include "MemoryStats.h"
 #include "NameMapper.h"
 #include "Xid.h"
 #include <gsl/gsl>
@@ -8,10 +9,14 @@ struct XmlAction;
 
 class Xml : public std::vector<gsl::not_null<Xml *>> { // \todo value semantics
 public:
-    Xid         id{0}; ///< id of the objet
-    std::string name;  ///< name of the element
+    Xid         id{0};         ///< id of the objet
+    std::string name;          ///< name of the element
+    bool        shared{false}; ///< in several trees, must not be modified
 
-    explicit Xml(const std::string &n) : name(std::string(n)) {}
+    explicit Xml(const std::string &n) : name(std::string(n)) {
+        memory_ns::xml_text_nodes++;
+        memory_ns::xml_text_bytes += n.size();
+    }
     Xml(const std::string &s, Xid n) : id(n), name(the_names[s]) {}
     Xml(std::string N, Xml *z);
 
@@ -40,7 +45,10 @@ public:
     auto find_on_tree(Xml *check, Xml *&res) const -> bool;
     auto get_first_env(const std::string &name) -> Xml *;
 
-    void add_att(const std::string &a, const std::string &b) const { id.add_attribute(a, b); }
+    void add_att(const std::string &a, const std::string &b) const {
+        assert(!shared); // NOLINT
+        id.add_attribute(a, b);
+    }
     void add_first(Xml *x);
     void add_ref(std::string s);
     void add_tmp(gsl::not_null<Xml *> x);
@@ -2,14 +2,15 @@
 #include "types.h"
 
 inline constexpr unsigned max_encoding        = 34;
-inline constexpr unsigned max_newcolumn_loops = 10000; // max nb of iterations
-inline constexpr unsigned nb_characters       = 65536; // Number of characters and size of char-index tables
-inline constexpr unsigned nb_mathchars        = 128;   // This is the number of slots for Mathml characters
-inline constexpr unsigned nb_newcolumn        = 128;   // Max char for newcolumntype
-inline constexpr unsigned nb_registers        = 1024;  // This is the number of other registers
-inline constexpr unsigned nb_shortverb_values = 256;   // This is the size of the table for shortverb
-inline constexpr unsigned nb_simplemath       = 128;   // Max char for which $x$ is trivial math
-inline constexpr unsigned nb_xspace_values    = 128;   // This is the size of the table ok_for_xspace
+inline constexpr unsigned max_newcolumn_loops = 10000;    // max nb of iterations
+inline constexpr unsigned nb_characters       = 65536;    // Number of characters and size of char-index tables
+inline constexpr unsigned nb_mathchars        = 128;      // This is the number of slots for Mathml characters
+inline constexpr unsigned nb_newcolumn        = 128;      // Max char for newcolumntype
+inline constexpr unsigned nb_registers        = 1024;     // This is the number of other registers
+inline constexpr unsigned nb_shortverb_values = 256;      // This is the size of the table for shortverb
+inline constexpr unsigned nb_simplemath       = 128;      // Max char for which $x$ is trivial math
+inline constexpr unsigned nb_unicode          = 0x110000; // Number of Unicode code points, for character tokens
+inline constexpr unsigned nb_xspace_values    = 128;      // This is the size of the table ok_for_xspace
 
 inline constexpr int bib_hash_mod  = 6397;
 inline constexpr int fi_family_mul = 64;
@@ -30,20 +31,22 @@ inline constexpr int tp_B_flag    = 64;
 inline constexpr int tp_C_flag    = 96;
 
 // When the parser sees a character C with a catcode B then
-// We have then cur_tok = nb_characters* B + C  < eqtb_offset
-inline constexpr unsigned eqtb_offset = 16 * nb_characters;
+// We have then cur_tok = nb_unicode* B + C  < eqtb_offset
+// Every Unicode scalar value is a character token; only the tables
+// indexed by characters (catcode, lccode, etc) stop at nb_characters.
+inline constexpr unsigned eqtb_offset = 16 * nb_unicode;
 
 // In all other cases, cur_tok >= eqtb_offset
 // and cur_tok-eqtb_offset is the eqtb location of cur_tok.
 // In the case of an active character C, we have
 // cur_tok=eqtb_offset +C < single_offset
-inline constexpr unsigned single_offset = nb_characters + eqtb_offset;
+inline constexpr unsigned single_offset = nb_unicode + eqtb_offset;
 
 // In the case of \C (mono char), we have
 // cur_tok = single_offset +C  < first_multitok_val
 // If cur_tok < single_offset, it is one of the above cases, and C can be
-// obtained by taking the value modulo nb_characters.
-inline constexpr unsigned first_multitok_val = nb_characters + single_offset;
+// obtained by taking the value modulo nb_unicode.
+inline constexpr unsigned first_multitok_val = nb_unicode + single_offset;
 
 // first_multitok_val is the location of an illegal token
 // After that comes a token with an empty name
@@ -1938,19 +1938,19 @@ enum subtypes : unsigned {
     letter_ticode = '~'
 };
 
-// nb_characters*cur_cmd for catcode 11 and 12.
+// nb_unicode*cur_cmd for catcode 11 and 12.
 enum spec_offsets : unsigned {
-    letter_t_offset    = letter_catcode * nb_characters,
-    other_t_offset     = other_catcode * nb_characters,
-    hat_t_offset       = hat_catcode * nb_characters,
-    space_t_offset     = space_catcode * nb_characters,
-    ampersand_t_offset = alignment_catcode * nb_characters,
-    RB_limit           = 3 * nb_characters,
-    CB_t_offset        = 2 * nb_characters,
-    OB_t_offset        = 1 * nb_characters,
-    eol_t_offset       = nb_characters * eol_catcode,
-    dollar_t_offset    = nb_characters * dollar_catcode,
-    dollar_limit       = nb_characters * (dollar_catcode + 1),
+    letter_t_offset    = letter_catcode * nb_unicode,
+    other_t_offset     = other_catcode * nb_unicode,
+    hat_t_offset       = hat_catcode * nb_unicode,
+    space_t_offset     = space_catcode * nb_unicode,
+    ampersand_t_offset = alignment_catcode * nb_unicode,
+    RB_limit           = 3 * nb_unicode,
+    CB_t_offset        = 2 * nb_unicode,
+    OB_t_offset        = 1 * nb_unicode,
+    eol_t_offset       = nb_unicode * eol_catcode,
+    dollar_t_offset    = nb_unicode * dollar_catcode,
+    dollar_limit       = nb_unicode * (dollar_catcode + 1),
 };
 
 enum system_type {
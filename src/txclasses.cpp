@@ -28,12 +28,13 @@ namespace {
 
     class ClassesData {
     public:
-        std::vector<LatexPackage *> packages;
-        OptionList                  unused_options;             // is \@unusedoptionlist in latex
-        OptionList                  global_options;             // is \@classoptionslist is latex
-        TokenList                   documentclass_hook;         // single hook for all classes
-        bool                        seen_document_class{false}; // have we seen a \documentclass command
-        bool                        using_default_class{false}; // inhibits warning
+        std::vector<LatexPackage *>             packages;
+        std::unordered_map<std::string, size_t> package_index;              // position in packages, by full name
+        OptionList                              unused_options;             // is \@unusedoptionlist in latex
+        OptionList                              global_options;             // is \@classoptionslist is latex
+        TokenList                               documentclass_hook;         // single hook for all classes
+        bool                                    seen_document_class{false}; // have we seen a \documentclass command
+        bool                                    using_default_class{false}; // inhibits warning
 
         ClassesData();
         auto        cur_pack() -> LatexPackage *;
@@ -124,17 +125,12 @@ void LatexPackage::add_options(const OptionList &L) {
 }
 
 // Returns true if S is in the option list (for check_builtin_class)
-auto classes_ns::is_raw_option(const OptionList &V, String s) -> bool {
-    return std::any_of(V.begin(), V.end(), [&s](const auto &i) { return i.name == s; });
-}
+auto classes_ns::is_raw_option(const OptionList &V, String s) -> bool { return V.find(s, true).has_value(); }
 
 // Returns true if slot is in the vector V with the same value
 auto classes_ns::is_in_option(const OptionList &V, const KeyAndVal &slot) -> bool {
-    const std::string &s = slot.name;
-    auto               n = V.size();
-    for (size_t i = 0; i < n; i++)
-        if (V[i].name == s) return compare(slot.val, V[i].val);
-    return false;
+    auto i = V.find(slot.name, true);
+    return i && compare(slot.val, V[*i].val);
 }
 
 // Returns true if each element of B is in A, i.e. A contains B
@@ -147,11 +143,7 @@ auto classes_ns::compare_options(const OptionList &A, const OptionList &B) -> bo
 
 // Like is_in_option, but returns a position
 // If X true, checks the keyname
-auto classes_ns::is_in_vector(const OptionList &V, const std::string &s, bool X) -> std::optional<size_t> {
-    for (size_t i = 0; i < V.size(); i++)
-        if (X ? (V[i].name == s) : (V[i].full_name == s)) return i;
-    return {};
-}
+auto classes_ns::is_in_vector(const OptionList &V, const std::string &s, bool X) -> std::optional<size_t> { return V.find(s, X); }
 
 // ------------------------------------------------------------
 
@@ -160,10 +152,11 @@ auto classes_ns::is_in_vector(const OptionList &V, const std::string &s, bool X)
 // Creates if creat is true.
 auto ClassesData::find_package(const std::string &name, bool type, bool creat) -> size_t {
     std::string full_name = (type ? "C"s : "P"s) + name;
-    auto        n         = packages.size();
-    for (size_t i = 1; i < n; i++)
-        if (packages[i]->has_name(full_name)) return i;
+    auto        it        = package_index.find(full_name);
+    if (it != package_index.end()) return it->second;
     if (!creat) return 0;
+    auto n = packages.size();
+    package_index.emplace(full_name, n);
     packages.push_back(new LatexPackage(full_name));
     return n;
 }
@@ -725,10 +718,8 @@ void Parser::add_language_att() const {
 }
 
 auto LatexPackage::find_option(const std::string &nname) -> long {
-    auto n = Poptions.size();
-    for (size_t i = 0; i < n; i++)
-        if (Poptions[i].name == nname) return to_signed(i);
-    return -1;
+    auto i = Poptions.find(nname, true);
+    return i ? to_signed(*i) : -1;
 }
 
 void ClassesData::remove_from_unused(const std::string &name) {
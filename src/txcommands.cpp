@@ -24,6 +24,25 @@ void show_unused_options();
 namespace {
     bool quote_started = false;
     Xml *glo_xml;
+
+    // True for the characters that translate_char handles specially
+    auto is_typo_trigger(char32_t c) -> bool {
+        switch (c) {
+        case '-':
+        case '\'':
+        case '`':
+        case '<':
+        case '>':
+        case '"':
+        case ';':
+        case ':':
+        case '!':
+        case '?':
+        case 0xBB:
+        case 0xAB: return true;
+        default: return false;
+        }
+    }
 } // namespace
 
 // Initialises the translator. The argument is the name of
@@ -185,6 +204,25 @@ void Parser::translate_char(CmdChr X) {
     }
 }
 
+// Fast path for body text. After a character has been translated, the
+// following tokens would come from input_line, unless TL is non-empty.
+// We consume the longest run of letters and others that translate_char
+// would simply append to the buffer, skipping the token machinery.
+void Parser::translate_run() {
+    if (!TL.empty() || restricted || tracing_commands() || !the_stack.in_h_mode()) return;
+    auto k = input_line_pos, n = input_line.size();
+    for (; k < n; ++k) {
+        char32_t c = input_line[k];
+        if (c == 0 || c > 65535 || is_typo_trigger(c)) break;
+        auto cc = get_catcode(c);
+        if (cc != letter_catcode && cc != other_catcode) break;
+    }
+    if (k == input_line_pos) return;
+    for (auto i = input_line_pos; i < k; ++i) unprocessed_xml.append_with_xml_escaping(input_line[i]);
+    input_line_pos = k;
+    state          = state_M;
+}
+
 // This translates `'<>
 // In some case ``, '', << and >> are translated as 0xAB and 0xBB
 void Parser::english_quotes(CmdChr X) {
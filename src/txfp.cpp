@@ -14,12 +14,14 @@
 #include "tralics/Logger.h"
 #include "tralics/Parser.h"
 #include <fmt/format.h>
+#include <unordered_map>
 
 namespace {
     Token                           fp_tmp_token, fp_test_token;
     std::array<Token, fp_last_code> fps;
     FpStack                         upn_stack;
     Buffer                          fp_in_buf;
+    std::unordered_map<std::string, TokenList> postfix_cache; // for \FPeval, see fp_e_eval
     const Digit                     fp_max  = 1000000000; // 10^9
     const Digit                     ten_8   = 100000000;  // 10^8
     Digit                           fp_seed = 123456789;
@@ -35,6 +37,32 @@ namespace {
 
     constexpr std::array<unsigned, 10> power_table{1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000, 100'000'000, 1'000'000'000};
 
+#if defined(__SIZEOF_INT128__)
+    // With 128-bit integers, mul and div work on the number scaled by
+    // 10^18, that is on two halves of 18 digits. The results are the same
+    // as those of the 1000-base code used otherwise.
+    __extension__ using u128 = unsigned __int128;
+    constexpr Digit ten_18   = 1'000'000'000'000'000'000;
+
+    auto high_half(const FpNum &X) -> Digit { return X.data[0] * fp_max + X.data[1]; }
+    auto low_half(const FpNum &X) -> Digit { return X.data[2] * fp_max + X.data[3]; }
+    void set_halves(FpNum &X, Digit h, Digit l) { X.set(h / fp_max, h % fp_max, l / fp_max, l % fp_max); }
+
+    // Sets X to v, which may exceed 10^36 (the first digit is then large)
+    void set_scaled(FpNum &X, u128 v) {
+        auto h = v / ten_18;
+        set_halves(X, Digit(h), Digit(v - h * ten_18));
+    }
+
+    // Keeps 36 digits of a product hi.10^18+lo, where lo<10^18
+    void finish_mul128(FpNum &X, u128 hi, Digit lo) {
+        if (hi >= ten_18) {
+            the_parser.parse_error("Overflow in FPmul");
+            hi %= ten_18;
+        }
+        set_halves(X, Digit(hi), lo);
+    }
+#else
     // Propagates the carry for a table of size 24 of 1000-based numbers
     void prop_carry(std::array<Digit, 24> &z) {
         Digit carry = 0;
@@ -63,6 +91,7 @@ namespace {
         }
         return {xmin, xmax};
     }
+#endif
 } // namespace
 
 namespace fp {
@@ -269,7 +298,15 @@ void FpNum::unsplit_mul4(const Digit *z) {
 // Computes the product XY. Both numbers are considered as a 12B number
 // (where B=1000).. The product gives a 24B number.
 void FpNum::mul(FpNum X, FpNum Y) {
-    bool                  xs = X.sign == Y.sign;
+    bool xs = X.sign == Y.sign;
+#if defined(__SIZEOF_INT128__)
+    Digit xh = high_half(X), xl = low_half(X), yh = high_half(Y), yl = low_half(Y);
+    u128  mid = u128(xh) * yl + u128(xl) * yh + u128(xl) * yl / ten_18;
+    u128  q   = mid / ten_18;
+    finish_mul128(*this, u128(xh) * yh + q, Digit(mid - q * ten_18));
+    sign = xs;
+    correct_sign();
+#else
     std::array<Digit, 12> x{}, y{};
     std::array<Digit, 24> z{}; // 0-filled
     X.mul_split(x);
@@ -280,21 +317,30 @@ void FpNum::mul(FpNum X, FpNum Y) {
         for (auto j = ymin; j < ymax; j++) z[i + j + 1] += x[i] * y[j];
     prop_carry(z);
     finish_mul(xs, z);
+#endif
 }
 
 // Multiplies by an integer, assumed to be less than 1000 and positive
 void FpNum::mul(FpNum X, int y) {
-    std::array<Digit, 12> x{};
-    std::array<Digit, 24> z{}; // 0-filled
-    bool                  xs = X.sign;
+    bool xs = X.sign;
     if (y < 0) {
         y  = -y;
         xs = !xs;
     }
+#if defined(__SIZEOF_INT128__)
+    u128 lo = u128(low_half(X)) * to_unsigned(y);
+    u128 q  = lo / ten_18;
+    finish_mul128(*this, u128(high_half(X)) * to_unsigned(y) + q, Digit(lo - q * ten_18));
+    sign = xs;
+    correct_sign();
+#else
+    std::array<Digit, 12> x{};
+    std::array<Digit, 24> z{}; // 0-filled
     X.mul_split(x);
     for (size_t i = 0; i < 12; i++) z[i + 6] = x[i] * to_unsigned(y);
     prop_carry(z);
     finish_mul(xs, z);
+#endif
 }
 
 // Converts the 24 1000-base number into a 12 1000-base number
@@ -663,7 +709,6 @@ void FpNum::add(const FpNum &X, const FpNum &Y) {
 
 // Divide by an integer n. Assumea that abs(n) <1000
 void FpNum::div(int n) {
-    std::array<Digit, 12> x{};
     if (n < 0) {
         sign = !sign;
         n    = -n;
@@ -672,6 +717,12 @@ void FpNum::div(int n) {
         the_parser.parse_error("Division by 0");
         return;
     }
+#if defined(__SIZEOF_INT128__)
+    auto  m = to_unsigned(n);
+    Digit h = high_half(*this);
+    set_halves(*this, h / m, Digit((u128(h % m) * ten_18 + low_half(*this)) / m));
+#else
+    std::array<Digit, 12> x{};
     mul_split(x);
     Digit carry = 0;
     for (auto &i : x) {
@@ -680,6 +731,7 @@ void FpNum::div(int n) {
         i       = a / to_unsigned(n);
     }
     unsplit_mul4(x.data());
+#endif
 }
 
 // It divides by 2.
@@ -841,6 +893,39 @@ void FpNum::div(FpNum X, FpNum Y) {
     }
     sign      = X.sign == Y.sign;
     int shift = 0;
+#if defined(__SIZEOF_INT128__)
+    // Same algorithm; Y is kept as two halves, so that Y/10 is cheap
+    const u128 norm = u128(ten_8) * ten_18 * fp_max; // 10^35
+    u128       x = u128(high_half(X)) * ten_18 + low_half(X), q = 0;
+    Digit      yh = high_half(Y), yl = low_half(Y);
+    for (; u128(yh) * ten_18 + yl < norm; shift++) {
+        yh = yh * 10 + yl / (ten_18 / 10);
+        yl = yl % (ten_18 / 10) * 10;
+    }
+    for (; x < norm; shift--) x *= 10;
+    while (yh != 0 || yl != 0) {
+        u128  y = u128(yh) * ten_18 + yl;
+        Digit i = 0;
+        for (; x >= y; i++) x -= y;
+        yl = (yh % 10 * ten_18 + yl) / 10;
+        yh /= 10;
+        q = q * 10 + i;
+        if (q >= norm * 10) {
+            the_parser.parse_error("Overflow in FPadd");
+            q -= norm * 10;
+        }
+    }
+    for (; shift > 17; shift--) {
+        if (q >= norm) {
+            the_parser.parse_error("Overflow in FPdiv");
+            set_scaled(*this, q);
+            return;
+        }
+        q *= 10;
+    }
+    for (; shift < 17; shift++) q /= 10;
+    set_scaled(*this, q);
+#else
     while (Y.data[0] < ten_8) {
         Y.mul_by_10();
         shift++;
@@ -868,6 +953,7 @@ void FpNum::div(FpNum X, FpNum Y) {
         div_by_10();
         shift++;
     }
+#endif
     correct_sign();
 }
 
@@ -1613,6 +1699,16 @@ auto Parser::fp_read_value() -> FpNum {
     return res;
 }
 
+// Same as fp_read_value, for a number of the upn stack that need not be read
+auto Parser::fp_use_value(const FpNum &res) -> FpNum {
+    err_tok = fp_name;
+    if (tracing_commands()) {
+        Logger::finish_seq();
+        the_log << "{FPread for " << fp_name << "=" << res << "}\n";
+    }
+    return res;
+}
+
 // Most functions have the form \FPfct\foo{arg}. This reads the \foo
 // and puts it in fp_res
 void Parser::fp_prepare() { fp_res = get_r_token(); }
@@ -1742,8 +1838,18 @@ void FpNum::random() {
 void Parser::fp_e_eval() {
     TokenList A = read_arg();
     TokenList B = read_arg();
-    FpGenList evaluator(B);
-    evaluator.to_postfix();
+    // The conversion to postfix does not expand tokens, so that the
+    // result depends only on B, and can be reused in a loop.
+    std::string key;
+    for (auto t : B) key.append(reinterpret_cast<const char *>(&t.val), sizeof(t.val));
+    auto it = postfix_cache.find(key);
+    if (it == postfix_cache.end()) {
+        if (postfix_cache.size() >= 1024) postfix_cache.clear();
+        FpGenList evaluator(B);
+        evaluator.to_postfix();
+        it = postfix_cache.emplace(std::move(key), std::move(evaluator)).first;
+    }
+    TokenList evaluator = it->second;
     if (tracing_commands()) {
         Logger::finish_seq();
         the_log << "{FPpostfix " << evaluator << "}\n";
@@ -2146,7 +2252,9 @@ void Parser::fp_e_upn() {
     upn_eval(L);
     if (upn_stack.empty()) {
         parse_error("UPN stack empty");
-        upn_stack.push_front(hash_table.zero_token);
+        TokenList zero;
+        zero.push_back(hash_table.zero_token);
+        upn_stack.push_upn(zero);
     }
     FpNum x;
     upn_stack.pop_upn(x);
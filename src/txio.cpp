@@ -14,6 +14,7 @@
 #include "tralics/Logger.h"
 #include "tralics/MainClass.h"
 #include "tralics/Saver.h"
+#include "tralics/Utf8Decoder.h"
 #include "tralics/util.h"
 #include <fmt/format.h>
 #include <fmt/ostream.h>
@@ -41,17 +42,15 @@ namespace io_ns {
 // Returns 0 at end of line or error
 // This complains if the character is greater than 1FFFF
 auto Buffer::next_utf8_char() -> char32_t {
-    auto     it = begin() + to_signed(ptrs.b), it0 = it;
+    if (ptrs.b >= size()) return char32_t();
     char32_t cp = 0;
-    try {
-        cp = it == end() ? char32_t(0U) : char32_t(utf8::next(it, end())); // \todo just if
-    } catch (utf8::invalid_utf8 &) {
+    auto     nn = utf8_ns::decode(*this, ptrs.b, cp);
+    if (nn == 0) {
         bad_chars++;
         spdlog::warn("{}:{}:{}: UTF-8 parsing error, ignoring char", cur_file_name, cur_file_line, ptrs.b + 1);
         ++ptrs.b;
         return char32_t();
     }
-    auto nn = to_unsigned(it - it0);
     ptrs.b += nn;
     if (cp > 0x1FFFF) {
         spdlog::error("UTF-8 parsing overflow (char U+{:04X}, line {}, file {})", size_t(cp), cur_file_line, cur_file_name);
@@ -258,7 +257,7 @@ auto main_ns::search_in_confdir(const std::string &s) -> std::optional<std::file
     for (auto i = conf_path.size(); i != 0; i--) {
         auto f = conf_path[i - 1] / s;
         if (std::filesystem::exists(f)) {
-            spdlog::trace("Found in configuration path: {}", f);
+            Logger::trace("Found in configuration path: {}", f);
             return f;
         }
     }
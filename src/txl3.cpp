@@ -41,7 +41,7 @@ void Parser::E_pdfstrcmp() {
     TokenList L   = token_ns::string_to_list(cmp == 0 ? "0" : (cmp < 0 ? "-1" : "1"), false);
     if (tracing_macros()) {
         Logger::finish_seq();
-        spdlog::trace("{}{}=={}->{}", cur_tok, s1, s2, L);
+        Logger::trace("{}{}=={}->{}", cur_tok, s1, s2, L);
     }
     back_input(L);
 }
@@ -718,13 +718,13 @@ void Parser::L3_set_cat_code(subtypes c) {
     else {
         Token T  = cur_tok;
         auto  ww = l3_read_int(T);
-        if (ww < 0 || ww > int(scan_char_num_max)) {
-            signal_ovf(T, "Bad character code replaced by 0\n", ww, scan_char_num_max);
+        if (ww < 0 || ww > int(nb_unicode - 1)) {
+            signal_ovf(T, "Bad character code replaced by 0\n", ww, nb_unicode - 1);
             w = 0;
         } else
             w = to_unsigned(ww);
     }
-    word_define(w, c, false);
+    word_define(char_code_pos(cat_code_offset, w), c, false);
 }
 
 // \char_set_catcode:nn{110}{`A+1} and variants: \the or \showthe
@@ -753,7 +753,7 @@ void Parser::L3_set_num_code(subtypes c) {
         break;
     case setlc_code:
         offset = lc_code_offset;
-        max    = nb_characters - 1;
+        max    = nb_unicode - 1;
         break;
     case thelc_code: offset = lc_code_offset; break;
     case showlc_code:
@@ -762,7 +762,7 @@ void Parser::L3_set_num_code(subtypes c) {
         break;
     case setuc_code:
         offset = uc_code_offset;
-        max    = nb_characters - 1;
+        max    = nb_unicode - 1;
         break;
     case theuc_code: offset = uc_code_offset; break;
     case showuc_code:
@@ -790,16 +790,16 @@ void Parser::L3_set_num_code(subtypes c) {
         }
         back_input(L1);
         cur_tok = T;
-        auto m  = scan_char_num();
-        word_define(m + offset, N, false); // \todo is offset always >=0?
+        auto m  = scan_unicode_num();
+        word_define(char_code_pos(offset, m), N, false);
         return;
     }
     auto m = l3_read_int(T);
-    if (m < 0 || m > int(scan_char_num_max)) {
-        signal_ovf(T, "Bad character code replaced by 0\n", m, scan_char_num_max);
+    if (m < 0 || m > int(nb_unicode - 1)) {
+        signal_ovf(T, "Bad character code replaced by 0\n", m, nb_unicode - 1);
         m = 0;
     }
-    auto v = eqtb_int_table[to_unsigned(m) + offset].val;
+    auto v = eqtb_int_val(char_code_pos(offset, to_unsigned(m)));
     if (show)
         log_and_tty << T << "{" << m << "}=" << v << "\n";
     else {
@@ -970,37 +970,48 @@ void Parser::Tl3_gen_from_ac(subtypes c) {
     back_input(creator);
 }
 
-// if args are set, Nn, Npn, this is
+// The definers \cs_set:Nn, \cs_set:cx, etc. are not created by L3_load,
+// but when the name is seen for the first time. For each base below, the
+// four signatures Nn, Nx, cn and cx are available.
+namespace {
+    const std::array<String, 12> l3_definer_bases = {"set",  "set_nopar",  "set_protected",  "set_protected_nopar",
+                                                     "gset", "gset_nopar", "gset_protected", "gset_protected_nopar",
+                                                     "new",  "new_nopar",  "new_protected",  "new_protected_nopar"};
+} // namespace
+
+// If sig is Nn, this is
 //  \def\cs_set:Nn{\__cs_generate_from_signature:NNn \cs_set:Npn}
-void Parser::define_definer(String base, String nsig, String osig) {
-    Token     nt = hash_table.locate(fmt::format("cs_{}:{}", base, nsig));
-    Token     ot = hash_table.locate(fmt::format("cs_{}:{}", base, osig));
+// and if sig is cn, this is
+//  \protected\def\cs_set:cn{\exp_args:Nc \cs_set:Nn}
+void Parser::define_definer(Token nt, const std::string &base, const std::string &sig) {
     TokenList L;
-    L.push_back(gen_from_sig_tok);
-    L.push_back(ot);
+    if (sig[0] == 'N') {
+        L.push_back(gen_from_sig_tok);
+        L.push_back(hash_table.locate(fmt::format("cs_{}:Np{}", base, sig[1])));
+    } else {
+        L.push_back(expargsnc_tok);
+        L.push_back(hash_table.locate(fmt::format("cs_{}:N{}", base, sig[1])));
+    }
     auto *X = new Macro(L);
     mac_define(nt, X, true, rd_always, userp_cmd);
 }
 
-// Example: if base is "set", this is
-//  \protected\def\cs_set:Nn{\exp_args:Nc \cs_set:Nn}
-//  \protected\def\cs_set:Nx{\exp_args:Nc \cs_set:Nx}
-void Parser::define_definer(String base) {
-    Token     nt = hash_table.locate(fmt::format("cs_{}:cn", base));
-    Token     ot = hash_table.locate(fmt::format("cs_{}:Nn", base));
-    TokenList L;
-    L.push_back(expargsnc_tok);
-    L.push_back(ot);
-    auto *X = new Macro(L);
-    mac_define(nt, X, true, rd_always, userp_cmd);
-    // gain
-    nt = hash_table.locate(fmt::format("cs_{}:cx", base));
-    ot = hash_table.locate(fmt::format("cs_{}:Nx", base));
-    TokenList L2;
-    L2.push_back(expargsnc_tok);
-    L2.push_back(ot);
-    auto *X2 = new Macro(L2);
-    mac_define(nt, X2, true, rd_always, userp_cmd);
+// True if s is the name of a definer that L3_lazy_define knows about.
+auto Parser::L3_lazy_name(const std::string &s) -> bool {
+    if (!s.starts_with("cs_")) return false;
+    auto k = s.find(':');
+    if (k == std::string::npos || s.size() != k + 3) return false;
+    auto sig = s.substr(k + 1);
+    if (sig != "Nn" && sig != "Nx" && sig != "cn" && sig != "cx") return false;
+    return std::find(l3_definer_bases.begin(), l3_definer_bases.end(), s.substr(3, k - 3)) != l3_definer_bases.end();
+}
+
+// Called by the hash table when the name s is entered for the first time
+// as token T, after latex3 has been loaded.
+void Parser::L3_lazy_define(const std::string &s, Token T) {
+    if (!L3_lazy_name(s)) return;
+    auto k = s.find(':');
+    define_definer(T, s.substr(3, k - 3), s.substr(k + 1));
 }
 
 // \cs_generate_variant:Nn \foo:nnn {Vn, xV}
@@ -1616,42 +1627,13 @@ void Parser::L3_load(bool preload) {
     shorthand_gdefine(char_def_code, "c_max_register_int", 1024);
     Tc_true_bool  = shorthand_gdefine(char_def_code, "c_true_bool", 1);
     Tc_false_bool = shorthand_gdefine(char_def_code, "c_false_bool", 0);
-    define_definer("set", "Nn", "Npn");
-    define_definer("set", "Nx", "Npx");
-    define_definer("set_nopar", "Nn", "Npn");
-    define_definer("set_nopar", "Nx", "Npx");
-    define_definer("set_protected", "Nn", "Npn");
-    define_definer("set_protected", "Nx", "Npx");
-    define_definer("set_protected_nopar", "Nn", "Npn");
-    define_definer("set_protected_nopar", "Nx", "Npx");
-    define_definer("gset", "Nn", "Npn");
-    define_definer("gset", "Nx", "Npx");
-    define_definer("gset_nopar", "Nn", "Npn");
-    define_definer("gset_nopar", "Nx", "Npx");
-    define_definer("gset_protected", "Nn", "Npn");
-    define_definer("gset_protected", "Nx", "Npx");
-    define_definer("gset_protected_nopar", "Nn", "Npn");
-    define_definer("gset_protected_nopar", "Nx", "Npx");
-    define_definer("new", "Nn", "Npn");
-    define_definer("new", "Nx", "Npx");
-    define_definer("new_nopar", "Nn", "Npn");
-    define_definer("new_nopar", "Nx", "Npx");
-    define_definer("new_protected", "Nn", "Npn");
-    define_definer("new_protected", "Nx", "Npx");
-    define_definer("new_protected_nopar", "Nn", "Npn");
-    define_definer("new_protected_nopar", "Nx", "Npx");
-    define_definer("set");
-    define_definer("set_nopar");
-    define_definer("set_protected");
-    define_definer("set_protected_nopar");
-    define_definer("gset");
-    define_definer("gset_nopar");
-    define_definer("gset_protected");
-    define_definer("gset_protected_nopar");
-    define_definer("new");
-    define_definer("new_nopar");
-    define_definer("new_protected");
-    define_definer("new_protected_nopar");
+    // Definers already in the hash table are defined now, the others on demand
+    hash_table.lazy_latex3 = true;
+    for (auto base : l3_definer_bases)
+        for (String sig : {"Nn", "Nx", "cn", "cx"}) {
+            auto name = fmt::format("cs_{}:{}", base, sig);
+            if (Hashtab::the_map().contains(name)) define_definer(hash_table.locate(name), base, sig);
+        }
 
     LineList L;
     L.insert("%% Begin bootstrap commands for latex3");
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <fmt/format.h>
 #include <fmt/ostream.h>
+#include <unordered_set>
 
 namespace {
     Buffer             math_buffer;
@@ -230,6 +231,18 @@ namespace {
         }
         return false;
     }
+
+    // Copies a cached formula for the document. Unlike Xml::deep_copy, text
+    // nodes are copied too, so that nothing is shared with the cache, except
+    // for the elements of the static math table, shared as usual.
+    auto copy_formula(Xml *x) -> Xml * {
+        if (the_stack.is_boot_xid(x->id)) return x;
+        if (x->is_xmlc()) return new Xml(x->name);
+        auto res = new Xml(x->name, nullptr);
+        res->id.add_attribute(x->id);
+        for (auto y : *x) res->push_back(gsl::not_null{copy_formula(y)});
+        return res;
+    }
 } // namespace
 
 using namespace math_ns;
@@ -592,12 +605,12 @@ void Math::push_back_list(subtypes X, math_list_type c) { push_back(MathElt(CmdC
 void MathDataP::push_back(size_t k, CmdChr X, subtypes c) { get_list(k).push_back(MathElt(X, c)); }
 
 // Adds a token to the list
-void Math::push_front(CmdChr X, subtypes c) { std::list<MathElt>::push_front(MathElt(X, c)); }
+void Math::push_front(CmdChr X, subtypes c) { MathList::push_front(MathElt(X, c)); }
 
 // Adds a character (cmd+chr). Uses current math font.
 void Math::push_back(CmdChr X) {
     auto font = subtypes(eqtb_int_table[math_font_pos].val);
-    std::list<MathElt>::push_back(MathElt(X, font));
+    MathList::push_back(MathElt(X, font));
 }
 
 // Add an xml element. If b>=0, this element is at position b in the table.
@@ -689,11 +702,100 @@ auto MathDataP::find_xml_location(Xml *y) -> subtypes {
     return find_xml_location();
 }
 
+// Payloads (for instance the rule width of \genfrac) are rare and often
+// identical; they are stored once, in a set whose elements never move.
+auto MathElt::intern_payload(std::string s) -> const std::string * {
+    static std::unordered_set<std::string> payloads;
+    if (s.empty()) return &no_payload;
+    return &*payloads.insert(std::move(s)).first;
+}
+
 MathElt::MathElt(Xml *x, math_types y) : CmdChr(math_xml_cmd, zero_code) {
     set_xmltype(y);
     chr = math_data.find_xml_location(x);
 }
 
+// Appends to key a description of the list, for the formula cache.
+// Returns false if the translation cannot be shared between formulas:
+// the list contains XML built while scanning, a box, a label or an
+// attribute command.
+auto Math::cache_key(std::string &key) const -> bool {
+    key += fmt::format("[{},{},{}:{}", int(type), int(sname), saved.size(), saved);
+    for (const auto &E : *this) {
+        if (E.cmd == math_xml_cmd && !MathDataP::is_builtin(E.chr)) return false;
+        if (E.is_hbox()) return false;
+        if (E.cmd == special_math_cmd) {
+            auto c = E.get_fml_subtype();
+            if (c == mathlabel_code || (c >= cell_attribute_code && c <= math_attribute_code)) return false;
+        }
+        if (E.is_math_list() || E.cmd == special_math_cmd) {
+            key += fmt::format("({},{}", int(E.cmd), int(E.get_font()));
+            if (!E.get_list().cache_key(key)) return false;
+        } else
+            key += fmt::format("({},{},{},{}:{}", int(E.cmd), int(E.chr), int(E.get_font()), E.get_payload().size(), E.get_payload());
+        key += ')';
+    }
+    key += ']';
+    return true;
+}
+
+// Converts the formula u, in style k. Identical formulas are converted
+// once; the translation is kept in the cache, and every use gets its own
+// copy of it. A formula whose conversion signals an error is not cached,
+// so that the error is reported again each time it is seen.
+auto MathDataP::convert_shared(Math &u, math_style k) -> Xml * {
+    std::string key = fmt::format("{},{}", int(k), eqtb_int_table[mathprop_ctr_code].val);
+    if (!u.cache_key(key)) {
+        ++formula_unshared;
+        return u.convert_math(k);
+    }
+    if (auto i = formula_cache.find(key); i != formula_cache.end()) {
+        ++formula_hits;
+        return copy_formula(i->second);
+    }
+    auto errs    = nb_errs;
+    share_leaves = true;
+    Xml *res     = u.convert_math(k);
+    share_leaves = false;
+    if (nb_errs != errs)
+        ++formula_unshared;
+    else {
+        ++formula_misses;
+        formula_cache.emplace(std::move(key), res);
+    }
+    return copy_formula(res);
+}
+
+// Returns <elt mathvariant='variant'>text</elt>, without attribute if
+// variant is empty. Inside a shareable formula, identical leaves are the
+// same object; it is marked as shared, hence read-only, and only appears
+// in the cached translations, the document getting copies.
+auto MathDataP::mk_leaf(const std::string &elt, const std::string &text, const std::string &variant) -> Xml * {
+    std::string key;
+    if (share_leaves) {
+        key = fmt::format("{}/{}/{}", elt, variant, text);
+        if (auto i = leaf_table.find(key); i != leaf_table.end()) {
+            ++leaf_reused;
+            return i->second;
+        }
+    }
+    Xml *res = new Xml(elt, new Xml(text));
+    if (!variant.empty()) res->add_att(the_names["mathvariant"], variant);
+    if (share_leaves) {
+        res->shared = true;
+        leaf_table.emplace(std::move(key), res);
+    }
+    return res;
+}
+
+void MathDataP::dump_formula_cache() const {
+    auto n = formula_hits + formula_misses + formula_unshared;
+    if (n == 0) return;
+    the_log << "Math formula cache: " << n << " formulas, " << formula_hits << " hits (" << formula_hits * 100 / n << "%), "
+            << formula_misses << " misses, " << formula_unshared << " not shareable\n";
+    if (!leaf_table.empty()) the_log << "Math leaves: " << leaf_table.size() << " shared, reused " << leaf_reused << " times\n";
+}
+
 // This kills the math elements
 void MathDataP::finish_math_mem() {
     for (size_t i = 0; i <= lmath_pos; i++) (*this)[i].clear();
@@ -873,7 +975,7 @@ auto Parser::T_math(subtypes type) -> bool {
                 return true;
             }
         }
-        res = u.convert_math(is_inline ? ms_T : ms_D);
+        res = math_data.convert_shared(u, is_inline ? ms_T : ms_D);
     }
     after_math(is_inline);
     // Insert the result in the tree.
@@ -1189,8 +1291,9 @@ auto Parser::scan_math(size_t res, math_list_type type) -> bool {
 // We have seen & or \\. Possibly inserts v-part
 auto Parser::scan_math_endcell(Token t) -> bool {
     if (the_stack.is_frame("cell") && !the_stack.is_omit_cell()) {
-        TokenList L = the_stack.get_u_or_v(false);
-        if (!L.empty()) {
+        const auto &V = the_stack.get_u_or_v(false);
+        if (!V.empty()) {
+            TokenList L = V;
             if (tracing_commands()) {
                 Logger::finish_seq();
                 the_log << "{template v-part " << L << "}\n";
@@ -1228,8 +1331,9 @@ auto Parser::scan_math_env(size_t res, math_list_type type) -> bool {
     // Check if v-part of template has to be inserted here
     if (!at_start && stack_math_in_cell()) {
         if (the_stack.is_frame("cell") && !the_stack.is_omit_cell()) {
-            TokenList L = the_stack.get_u_or_v(false);
-            if (!L.empty()) {
+            const auto &V = the_stack.get_u_or_v(false);
+            if (!V.empty()) {
+                TokenList L = V;
                 if (tracing_commands()) {
                     Logger::finish_seq();
                     the_log << "{template v-part " << L << "}\n";
@@ -2249,7 +2353,7 @@ auto MathElt::cv_special1(math_style cms) const -> MathElt {
         L.pop_front();
         close = L.front().chr;
         L.pop_front();
-        sz = L.front().payload;
+        sz = L.front().get_payload();
         L.pop_front();
         if (L.front().cmd == style_cmd) {
             cms   = style_level(L.front().chr);
@@ -2842,11 +2946,11 @@ void Math::handle_cmd_Big(math_style cms) {
 }
 
 auto Math::handle_cmd_Big_aux(math_style cms) -> bool {
-    std::list<MathElt> res;
-    Math               aux;
-    bool               state     = false;
-    bool               ok        = false; // true if we have added a fence
-    bool               try_again = false; // true if formula has unused \big
+    MathList res;
+    Math     aux;
+    bool     state     = false;
+    bool     ok        = false; // true if we have added a fence
+    bool     try_again = false; // true if formula has unused \big
     while (!empty()) {
         auto       cmd = front().cmd;
         math_types t   = front().get_xmltype();
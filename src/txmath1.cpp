@@ -12,6 +12,7 @@
 
 #include "tralics/Logger.h"
 #include "tralics/Math.h"
+#include "tralics/MathDataP.h"
 #include "tralics/MathF.h"
 #include "tralics/MathP.h"
 #include "tralics/Parser.h"
@@ -533,7 +534,7 @@ void MathElt::cv_noML_special() const {
         else
             math_ns::insert_delimiter(k);
         L.pop_front();
-        auto sz = L.front().payload;
+        auto sz = L.front().get_payload();
         mathml_buffer += '{' + sz + '}';
         L.pop_front();
         if (L.front().cmd == style_cmd)
@@ -641,7 +642,7 @@ void MathElt::cv_noMLt_special0() const {
             L.pop_front();
         }
         if (!L.empty()) {
-            att_buffer = L.front().payload;
+            att_buffer = L.front().get_payload();
             if (!att_buffer.empty()) mathml_buffer += " size='" + att_buffer + "'";
             L.pop_front();
         }
@@ -1320,18 +1321,12 @@ void Parser::TM_fonts() {
 auto math_ns::mk_mi(char32_t c) -> Xml * {
     aux_buffer.clear();
     aux_buffer.append_with_xml_escaping(c);
-    Xml *x = new Xml(std::string(aux_buffer));
-    return new Xml(the_names["mi"], x);
+    return math_data.mk_leaf(the_names["mi"], aux_buffer, "");
 }
 
 // Converts a letter with a into into <mi mathvariant='foo'>X</mi>
 // Assumes 2<=font<=14 and 'a'<=c<='z' || 'A'<=c<='Z'
-auto math_ns::mk_mi(uchar c, size_t font) -> Xml * {
-    Xml *x = single_chars[c];
-    Xml *y = new Xml(the_names["mi"], x);
-    y->add_att(the_names["mathvariant"], the_names.cstf(font));
-    return y;
-}
+auto math_ns::mk_mi(uchar c, size_t font) -> Xml * { return math_data.mk_leaf(the_names["mi"], single_chars[c]->name, the_names.cstf(font)); }
 
 // True if this can form a sequence of characters to put in a <mi>
 auto MathElt::maybe_seq() const -> bool {
@@ -1392,9 +1387,7 @@ auto Math::convert_char_seq(const MathElt &W) -> MathElt {
         pop_front();
     }
     if (f == 1) B.push_back(' ');
-    res = new Xml(std::string(B));
-    res = new Xml(the_names["mi"], res);
-    if (f > 1 && spec) res->add_att(the_names["mathvariant"], the_names.cstf(f));
+    res = math_data.mk_leaf(the_names["mi"], B, f > 1 && spec ? the_names.cstf(f) : std::string());
     return MathElt(res, mt_flag_small);
 }
 
@@ -1415,8 +1408,6 @@ auto Math::convert_char_iseq(const MathElt &W, bool multiple) -> MathElt {
             B.push_back(char(uchar(c)));
             pop_front();
         }
-    Xml *res = new Xml(std::string(B));
-    res      = new Xml(the_names["mn"], res);
-    if (f > 1) res->add_att(the_names["mathvariant"], the_names.cstf(f));
+    Xml *res = math_data.mk_leaf(the_names["mn"], B, f > 1 ? the_names.cstf(f) : std::string());
     return MathElt(res, mt_flag_small);
 }
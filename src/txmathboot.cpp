@@ -1294,10 +1294,7 @@ auto math_ns::make_math_char(uchar c, size_t n) -> Xml * {
         B.push_back(static_cast<char>(c));
     else
         B.append(math_chars[c][n]);
-    Xml *v   = new Xml(B);
-    Xml *res = new Xml(the_names["mi"], v);
-    if (n == 1) res->add_att(the_names["mathvariant"], the_names["normal"]);
-    return res;
+    return math_data.mk_leaf(the_names["mi"], B, n == 1 ? the_names["normal"] : std::string());
 }
 
 void MathDataP::boot_chars() {
@@ -1388,6 +1385,566 @@ void MathDataP::boot2() {
     hash_table.mmlprescripts_token = init_builtin("mmlprescripts", mml_prescripts_code, x, mathord_cmd);
 }
 
+namespace {
+    // How the entries of math_symbols are built, see MathDataP::boot_symbols.
+    enum class sym_kind { ic, icb, oc, ocx, oco, ocol, ocb, ocr, moo };
+
+    struct MathSymbol {
+        sym_kind kind;
+        String   name, ent, ent2;
+        math_loc pos;
+        symcodes t{mathord_cmd}; // only for ocx
+        bool     hack{true};     // only for ocx
+    };
+
+    // Greek letters, operators, relations, etc. This is static data; booting
+    // the math tables just walks this array.
+    constexpr std::array<MathSymbol, 500> math_symbols{{
+        {sym_kind::icb, "alpha", "&alpha;", "&#x3B1;", alpha_code},
+        {sym_kind::icb, "beta", "&beta;", "&#x3B2;", beta_code},
+        {sym_kind::icb, "gamma", "&gamma;", "&#x3B3;", gamma_code},
+        {sym_kind::icb, "delta", "&delta;", "&#x3B4;", delta_code},
+        {sym_kind::icb, "epsilon", "&straightepsilon;", "&#x3F5;", epsilon_code},
+        {sym_kind::icb, "varepsilon", "&varepsilon;", "&#x3B5;", varepsilon_code},
+        {sym_kind::icb, "zeta", "&zeta;", "&#x3B6;", zeta_code},
+        {sym_kind::icb, "eta", "&eta;", "&#x3B7;", eta_code},
+        {sym_kind::icb, "theta", "&theta;", "&#x3B8;", theta_code},
+        {sym_kind::icb, "iota", "&iota;", "&#x3B9;", iota_code},
+        {sym_kind::icb, "kappa", "&kappa;", "&#x3BA;", kappa_code},
+        {sym_kind::icb, "lambda", "&lambda;", "&#x3BB;", lambda_code},
+        {sym_kind::icb, "mu", "&mu;", "&#x3BC;", mu_code},
+        {sym_kind::icb, "nu", "&nu;", "&#x3BD;", nu_code},
+        {sym_kind::icb, "xi", "&xi;", "&#x3BE;", xi_code},
+        {sym_kind::icb, "pi", "&pi;", "&#x3C0;", pi_code},
+        {sym_kind::icb, "rho", "&rho;", "&#x3C1;", rho_code},
+        {sym_kind::icb, "sigma", "&sigma;", "&#x3C3;", sigma_code},
+        {sym_kind::icb, "tau", "&tau;", "&#x3C4;", tau_code},
+        {sym_kind::icb, "upsilon", "&upsi;", "&#x3C5;", upsilon_code},
+        {sym_kind::icb, "phi", "&phi;", "&#x3C6;", phi_code},
+        {sym_kind::icb, "varphi", "&phiv;", "&#x3D5;", varphi_code},
+        {sym_kind::icb, "chi", "&chi;", "&#x3C7;", chi_code},
+        {sym_kind::icb, "psi", "&psi;", "&#x3C8;", psi_code},
+        {sym_kind::icb, "omega", "&omega;", "&#x3C9;", omega_code},
+        {sym_kind::icb, "digamma", "&digamma;", "&#x3DD;", digamma_code},
+        {sym_kind::icb, "varpi", "&piv;", "&#x3D6;", varpi_code},
+        {sym_kind::icb, "varrho", "&rhov;", "&#x3F1;", varrho_code},
+        {sym_kind::icb, "varsigma", "&sigmav;", "&#x3C2;", varsigma_code},
+        {sym_kind::icb, "vartheta", "&thetav;", "&#x3D1;", vartheta_code},
+        {sym_kind::icb, "varkappa", "&kappav;", "&#x3F0;", varkappa_code},
+        {sym_kind::icb, "Gamma", "&Gamma;", "&#x393;", Gamma_code},
+        {sym_kind::icb, "Delta", "&Delta;", "&#x394;", Delta_code},
+        {sym_kind::icb, "Theta", "&Theta;", "&#x398;", Theta_code},
+        {sym_kind::icb, "Lambda", "&Lambda;", "&#x39B;", Lambda_code},
+        {sym_kind::icb, "Xi", "&Xi;", "&#x39E;", Xi_code},
+        {sym_kind::icb, "Sigma", "&Sigma;", "&#x3A3;", Sigma_code},
+        {sym_kind::icb, "Upsilon", "&Upsi;", "&#x3A5;", Upsilon_code},
+        {sym_kind::icb, "Phi", "&Phi;", "&#x3A6;", Phi_code},
+        {sym_kind::icb, "Pi", "&Pi;", "&#x3A0;", Pi_code},
+        {sym_kind::icb, "Psi", "&Psi;", "&#x3A8;", Psi_code},
+        {sym_kind::icb, "Omega", "&Omega;", "&#x3A9;", Omega_code},
+        {sym_kind::ic, "hbar", "&#x127;", "&#x127;", hbar_code},
+        {sym_kind::ic, "hslash", "&hbar;", "&#x0210F;", hbar_code},
+        {sym_kind::ic, "ell", "&ell;", "&#x02113;", ell_code}, // pb
+        {sym_kind::ic, "wp", "&wp;", "&#x02118;", wp_code},
+        {sym_kind::ic, "Re", "&Re;", "&#x0211C;", Re_code},
+        {sym_kind::ic, "Im", "&Im;", "&#x02111;", Im_code},
+
+        // Other mi alphabetic order
+        {sym_kind::ic, "aleph", "&aleph;", "&#x02135;", aleph_code},
+        {sym_kind::ic, "angle", "&ang;", "&#x02220;", angle_code},
+        {sym_kind::ic, "backprime", "&backprime;", "&#x2035;", backprime_code},
+        {sym_kind::ic, "beth", "&beth;", "&#x02136;", beth_code},
+        {sym_kind::ic, "bigstar", "&bigstar;", "&#x2605;", bigstar_code},
+        {sym_kind::ic, "blacklozenge", "&blacklozenge;", "&#x29EB;", blacklozenge_code},
+        {sym_kind::ic, "blacksquare", "&blacksquare;", "&#x25AA;", blacksquare_code},
+        {sym_kind::ic, "blacktriangledown", "&blacktriangledown;", "&#x25BE;", blacktriangledown_code},
+        {sym_kind::ic, "blacktriangle", "&blacktriangle;", "&#x25B4;", blacktriangle_code},
+        {sym_kind::ic, "bot", "&bottom;", "&#x022A5;", bot_code},
+        {sym_kind::ic, "bottom", "&bottom;", "&#x022A5;", bottom_code}, // eval_let ?????
+        {sym_kind::ic, "circledS", "&circledS;", "&#x24C8;", circledS_code},
+        {sym_kind::ic, "complement", "&complement;", "&#x02201;", complement_code},
+        {sym_kind::ic, "daleth", "&daleth;", "&#x2138;", daleth_code},
+        {sym_kind::ic, "diagdown", "&setminus;", "&#x2216;", diagdown_code},
+        {sym_kind::ic, "diagup", "&#x2215;", "&#x2215;", diagup_code},
+        {sym_kind::ic, "emptyset", "&emptyset;", "&#x2205;", emptyset_code},
+        {sym_kind::ic, "eth", "&eth;", "&#xF0;", eth_code},
+        {sym_kind::ic, "ExponentialE", "&ExponentialE;", "&#x2147;", exponentiale_code},
+        {sym_kind::ic, "Finv", "&#x2132;", "&#x2132;", Finv_code},
+        {sym_kind::ic, "Game", "&#x2141;", "&#x2141;", Game_code},
+        {sym_kind::ic, "gimel", "&gimel;", "&#x2137;", gimel_code},
+        {sym_kind::ic, "ImaginaryI", "&ImaginaryI;", "&#x2148;", imaginaryi_code},
+        {sym_kind::ic, "infty", "&infin;", "&#x0221E;", infty_code},
+        {sym_kind::ic, "lightning", "&#x2607;", "&#x2607;", lightning_code},
+        {sym_kind::ic, "lozenge", "&lozenge;", "&#x25CA;", lozenge_code},
+        {sym_kind::ic, "nabla", "&nabla;", "&#x02207;", nabla_code},
+        {sym_kind::ic, "measuredangle", "&measuredangle;", "&#x2221;", measuredangle_code},
+        {sym_kind::ic, "mathparagraph", "&para;", "&#xB6;", mathparagraph_code},
+        {sym_kind::ic, "mathsection", "&sect;", "&#xA7;", mathsection_code},
+        {sym_kind::ic, "partial", "&part;", "&#x02202;", partial_code},
+        {sym_kind::ic, "nexists", "&nexists;", "&#x02204;", nexists_code},
+        {sym_kind::ic, "surd", "&radic;", "&#x0221A;", surd_code},
+        {sym_kind::ic, "sphericalangle", "&angsph;", "&#x2222;", sphericalangle_code},
+        {sym_kind::ic, "top", "&top;", "&#x022A4;", top_code},
+        {sym_kind::ic, "triangle", "&triangle;", "&#x025B5;", triangle_code},
+        {sym_kind::ic, "varnothing", "&#x2300;", "&#x2300;", varnothing_code},
+
+        // mathop rm.. alphabetic order
+        {sym_kind::moo, "arccos", "arccos", nullptr, arccos_code},
+        {sym_kind::moo, "arcsin", "arcsin", nullptr, arcsin_code},
+        {sym_kind::moo, "arctan", "arctan", nullptr, arctan_code},
+        {sym_kind::moo, "arg", "arg", nullptr, arg_code},
+        {sym_kind::moo, "cos", "cos", nullptr, cos_code},
+        {sym_kind::moo, "cosh", "cosh", nullptr, cosh_code},
+        {sym_kind::moo, "cot", "cot", nullptr, cot_code},
+        {sym_kind::moo, "coth", "coth", nullptr, coth_code},
+        {sym_kind::moo, "csc", "csc", nullptr, csc_code},
+        {sym_kind::moo, "deg", "deg", nullptr, deg_code},
+        {sym_kind::moo, "det", "det", nullptr, det_code},
+        {sym_kind::moo, "dim", "dim", nullptr, dim_code},
+        {sym_kind::moo, "exp", "exp", nullptr, exp_code},
+        {sym_kind::moo, "gcd", "gcd", nullptr, gcd_code},
+        {sym_kind::moo, "hom", "hom", nullptr, hom_code},
+        {sym_kind::moo, "inf", "inf", nullptr, inf_code},
+        {sym_kind::moo, "injlim", "inj lim", nullptr, injlim_code},
+        {sym_kind::moo, "ker", "ker", nullptr, ker_code},
+        {sym_kind::moo, "lg", "lg", nullptr, lg_code},
+        {sym_kind::moo, "lim", "lim", nullptr, lim_code},
+        {sym_kind::moo, "liminf", "lim inf", nullptr, liminf_code},
+        {sym_kind::moo, "limsup", "lim sup", nullptr, limsup_code},
+        {sym_kind::moo, "ln", "ln", nullptr, ln_code},
+        {sym_kind::moo, "log", "log", nullptr, log_code},
+        {sym_kind::moo, "max", "max", nullptr, max_code},
+        {sym_kind::moo, "min", "min", nullptr, min_code},
+        {sym_kind::moo, "Pr", "Pr", nullptr, Pr_code},
+        {sym_kind::moo, "projlim", "proj lim", nullptr, projlim_code},
+        {sym_kind::moo, "sec", "sec", nullptr, sec_code},
+        {sym_kind::moo, "sin", "sin", nullptr, sin_code},
+        {sym_kind::moo, "@mod", "mod", nullptr, mod_code},
+        {sym_kind::moo, "sinh", "sinh", nullptr, sinh_code},
+        {sym_kind::moo, "sup", "sup", nullptr, sup_code},
+        {sym_kind::moo, "tan", "tan", nullptr, tan_code},
+        {sym_kind::moo, "tanh", "tanh", nullptr, tanh_code},
+
+        {sym_kind::oc, "forall", "&forall;", "&#x02200;", forall_code},
+        {sym_kind::oc, "exists", "&exist;", "&#x02203;", exists_code},
+
+        // type large
+        {sym_kind::ocol, "coprod", "&coprod;", "&#x02210;", coprod_code},
+        {sym_kind::ocol, "bigvee", "&bigvee;", "&#x022C1;", bigvee_code}, // pb
+        {sym_kind::ocol, "bigwedge", "&bigwedge;", "&#x022C0;", bigwedge_code}, // pb
+        {sym_kind::ocol, "biguplus", "&uplus;", "&#x0228E;", biguplus_code},
+        {sym_kind::ocol, "bigcap", "&bigcap;", "&#x022C2;", bigcap_code},
+        {sym_kind::ocol, "bigcup", "&bigcup;", "&#x022C3;", bigcup_code},
+        {sym_kind::oco, "int", "&int;", "&#x0222B;", int_code},
+        {sym_kind::oco, "xiint", "&#x0222C;", "&#x0222C;", xiint_code},
+        {sym_kind::oco, "xiiint", "&iiint;", "&#x0222D;", xiiint_code},
+        {sym_kind::oco, "xiiiint", "&iiiint;", "&#x02A0C;", xiiiint_code},
+        {sym_kind::ocol, "sum", "&sum;", "&#x02211;", sum_code},
+        {sym_kind::ocol, "prod", "&prod;", "&#x0220F;", prod_code},
+        {sym_kind::ocol, "bigotimes", "&bigotimes;", "&#x02A02;", bigotimes_code},
+        {sym_kind::ocol, "bigoplus", "&bigoplus;", "&#x02A01;", bigoplus_code},
+        {sym_kind::ocol, "bigodot", "&bigodot;", "&#x02A00;", bigodot_code},
+        {sym_kind::oco, "oint", "&oint;", "&#x0222E;", oint_code},
+        {sym_kind::ocol, "bigsqcup", "&bigsqcup;", "&#x02A06;", bigsqcup_code},
+        {sym_kind::oco, "smallint", "&int;", "&#x0222B;", smallint_code}, // pas de small...
+
+        // type bin
+        {sym_kind::ocb, "triangleq", "&triangleq;", "&#x0225C;", triangleq_code},
+        {sym_kind::ocb, "triangleleft", "&triangleleft;", "&#x025C3;", triangleleft_code},
+        {sym_kind::ocb, "triangleright", "&triangleright;", "&#x025B9;", triangleright_code},
+        {sym_kind::ocb, "bigtriangleup", "&bigtriangleup;", "&#x025B3;", bigtriangleup_code},
+        {sym_kind::ocb, "bigtriangledown", "&bigtriangledown;", "&#x025BD;", bigtriangledown_code},
+        {sym_kind::ocb, "wedge", "&wedge;", "&#x02227;", wedge_code},
+        {sym_kind::ocb, "land", "&wedge;", "&#x02227;", wedge_code},
+        {sym_kind::ocb, "vee", "&vee;", "&#x02228;", vee_code},
+        {sym_kind::ocb, "lor", "&vee;", "&#x02228;", vee_code},
+        {sym_kind::ocb, "cap", "&cap;", "&#x02229;", cap_code},
+        {sym_kind::ocb, "cup", "&cup;", "&#x0222A;", cup_code},
+        {sym_kind::ocb, "Cap", "&Cap;", "&#x022D2;", Cap_code},
+        {sym_kind::ocb, "Cup", "&Cup;", "&#x022D3;", Cup_code},
+        {sym_kind::ocb, "multimap", "&multimap;", "&#x022B8;", multimap_code},
+        {sym_kind::ocb, "dagger", "&dagger;", "&#x02020;", dagger_code},
+        {sym_kind::ocb, "ddagger", "&ddagger;", "&#x02021;", ddagger_code},
+        {sym_kind::ocb, "sqcap", "&sqcap;", "&#x02293;", sqcap_code},
+        {sym_kind::ocb, "sqcup", "&sqcup;", "&#x02294;", sqcup_code},
+        {sym_kind::ocb, "amalg", "&amalg;", "&#x02A3F;", almalg_code},
+        {sym_kind::ocb, "diamond", "&diamond;", "&#x022C4;", diamand_code},
+        {sym_kind::ocb, "Diamond", "&diamond;", "&#x022C4;", Diamond_code},
+        {sym_kind::ocb, "bullet", "&bullet;", "&#x02022;", bullet_code},
+        {sym_kind::ocb, "wr", "&wr;", "&#x02240;", wr_code},
+        {sym_kind::ocb, "div", "&div;", "&#xF7;", div_code},
+        {sym_kind::ocb, "odot", "&odot;", "&#x02299;", odot_code},
+        {sym_kind::ocb, "oslash", "&osol;", "&#x02298;", oslash_code},
+        {sym_kind::ocb, "otimes", "&otimes;", "&#x02297;", otimes_code},
+        {sym_kind::ocb, "ominus", "&ominus;", "&#x02296;", ominus_code},
+        {sym_kind::ocb, "oplus", "&oplus;", "&#x02295;", oplus_code},
+        {sym_kind::ocb, "uplus", "&uplus;", "&#x0228E;", uplus_code},
+        {sym_kind::ocb, "mp", "&mp;", "&#x02213;", mp_code},
+        {sym_kind::ocb, "pm", "&pm;", "&#xB1;", pm_code},
+        {sym_kind::ocb, "circ", "&SmallCircle;", "&#x02218;", circ_code}, // pb
+        {sym_kind::ocb, "bigcirc", "&bigcirc;", "&#x025EF;", bigcirc_code}, // pb
+        {sym_kind::ocb, "setminus", "&setminus;", "&#x02216;", setminus_code},
+        {sym_kind::ocb, "cdot", "&middot;", "&#xB7;", cdot_code}, // pb
+        {sym_kind::ocb, "ast", "&ast;", "&#x2A;", ast_code},
+        {sym_kind::ocb, "times", "&times;", "&#xD7;", times_code},
+        {sym_kind::ocb, "star", "&star;", "&#x02606;", star_code},
+        {sym_kind::ocb, "*", "&InvisibleTimes;", "&#x02062;", starchar_code},
+        {sym_kind::ocb, "InvisibleTimes", "&InvisibleTimes;", "&#x2062;", starchar_code},
+        {sym_kind::ocb, "ApplyFunction", "&ApplyFunction;", "&#x2061;", applyfct_code},
+        {sym_kind::ocb, "InvisibleComma", "&InvisibleComma;", "&#x2063;", invisiblecomma_code},
+        {sym_kind::ocb, "baro", "&ovbar;", "&#x233D;", baro_code},
+        {sym_kind::ocb, "barwedge", "&#x22BC;", "&#x22BC;", barwedge_code},
+        {sym_kind::ocb, "curlyvee", "&curlyvee;", "&#x22CE;", curlyvee_code},
+        {sym_kind::ocb, "curlywedge", "&curlywedge;", "&#x22CF;", curlywedge_code},
+        {sym_kind::ocb, "divideontimes", "&divideontimes;", "&#x22C7;", divideontimes_code},
+        {sym_kind::ocb, "dotplus", "&dotplus;", "&#x2214;", dotplus_code},
+        {sym_kind::ocb, "gtrdot", "&gtrdot;", "&#x22D7;", gtrdot_code},
+        {sym_kind::ocb, "intercal", "&intercal;", "&#x22BA;", intercal_code},
+        {sym_kind::ocb, "interleave", "&#x2AF4;", "&#x2AF4;", interleave_code},
+        {sym_kind::ocb, "leftslice", "&#x2AA6;", "&#x2AA6;", leftslice_code},
+        {sym_kind::ocb, "rightslice", "&#x2AA7;", "&#x2AA7;", rightslice_code},
+        {sym_kind::ocb, "leftthreetimes", "&leftthreetimes;", "&#x22CB;", leftthreetimes_code},
+        {sym_kind::ocb, "rightthreetimes", "&rightthreetimes;", "&#x22CC;", rightthreetimes_code},
+        {sym_kind::ocb, "lessdot", "&lessdot;", "&#x22D6;", lessdot_code},
+        {sym_kind::ocb, "ltimes", "&ltimes;", "&#x22C9;", ltimes_code},
+        {sym_kind::ocb, "rtimes", "&rtimes;", "&#x22CA;", rtimes_code},
+        {sym_kind::ocb, "merge", "&#x2A07;", "&#x2A07;", merge_code},
+        {sym_kind::ocb, "sslash", "&#x2AFD;", "&#x2AFD;", sslash_code},
+        {sym_kind::ocb, "talloblong", "&#x2AFF;", "&#x2AFF;", talloblong_code},
+        {sym_kind::ocb, "boxast", "&#x29C6;", "&#x29C6;", boxast_code},
+        {sym_kind::ocb, "boxbox", "&#x29C8;", "&#x29C8;", boxbox_code},
+        {sym_kind::ocb, "boxbslash", "&bsolb;", "&#x29C5;", boxbslash_code},
+        {sym_kind::ocb, "boxcircle", "&#x29C7;", "&#x29C7;", boxcircle_code},
+        {sym_kind::ocb, "boxdot", "&dotsquare;", "&#x22A1;", boxdot_code},
+        {sym_kind::ocb, "boxminus", "&boxminus;", "&#x229F;", boxminus_code},
+        {sym_kind::ocb, "boxplus", "&boxplus;", "&#x229E;", boxplus_code},
+        {sym_kind::ocb, "boxslash", "&solb;", "&#x29C4;", boxslash_code},
+        {sym_kind::ocb, "boxtimes", "&boxtimes;", "&#x22A0;", boxtimes_code},
+        {sym_kind::ocb, "centerdot", "&sdot;", "&#x22C5;", centerdot_code},
+        {sym_kind::ocb, "circledast", "&circledast;", "&#x229B;", circledast_code},
+        {sym_kind::ocb, "circledcirc", "&circledcirc;", "&#x229A;", circledcirc_code},
+        {sym_kind::ocb, "circleddash", "&circleddash;", "&#x229D;", circleddash_code},
+        {sym_kind::ocb, "obar", "&omid;", "&#x29B6;", obar_code},
+        {sym_kind::ocb, "ogreaterthan", "&ogt;", "&#x29C1;", ogreaterthan_code},
+        {sym_kind::ocb, "olessthan", "&olt;", "&#x29C0;", olessthan_code},
+        {sym_kind::ocb, "varocircle", "&#x29BE;", "&#x29BE;", varocircle_code},
+
+        // Rel
+        {sym_kind::ocr, "propto", "&propto;", "&#x0221D;", propto_code},
+        {sym_kind::ocr, "sqsubseteq", "&sqsubseteq;", "&#x02291;", sqsubseteq_code},
+        {sym_kind::ocr, "sqsupseteq", "&sqsupseteq;", "&#x02292;", sqsupseteq_code},
+        {sym_kind::ocr, "sqsubset", "&sqsubset;", "&#x0228F;", sqsubset_code},
+        {sym_kind::ocr, "sqsupset", "&sqsupset;", "&#x02290;", sqsupset_code},
+        {sym_kind::ocr, "parallel", "&parallel;", "&#x02225;", parallel_code},
+        {sym_kind::ocr, "mid", "&mid;", "&#x02223;", mid_code},
+        {sym_kind::ocr, "dashv", "&dashv;", "&#x022A3;", dashv_code},
+        {sym_kind::ocr, "vdash", "&vdash;", "&#x022A2;", vdash_code},
+        {sym_kind::ocr, "Vdash", "&Vdash;", "&#x022A9;", Vdash_code},
+        {sym_kind::ocr, "vDash", "&vDash;", "&#x22A7;", vDash_code},
+        {sym_kind::ocr, "VDash", "&VDash;", "&#x22AB;", VDash_code},
+        {sym_kind::ocr, "Vvdash", "&Vvdash;", "&#x22AA;", Vvdash_code},
+        {sym_kind::ocr, "models", "&models;", "&#x022A7;", models_code},
+        {sym_kind::ocr, "nearrow", "&nearrow;", "&#x02197;", nearrow_code},
+        {sym_kind::ocr, "searrow", "&searrow;", "&#x02198;", searrow_code},
+        {sym_kind::ocr, "nwarrow", "&nwarrow;", "&#x02196;", nwarrow_code},
+        {sym_kind::ocr, "swarrow", "&swarrow;", "&#x02199;", swarrow_code},
+        {sym_kind::ocr, "Leftrightarrow", "&Leftrightarrow;", "&#x021D4;", Leftrightarrow_code},
+        {sym_kind::ocr, "Leftarrow", "&Leftarrow;", "&#x021D0;", Leftarrow_code},
+        {sym_kind::ocr, "Rightarrow", "&Rightarrow;", "&#x021D2;", Rightarrow_code},
+        {sym_kind::ocr, "implies", "&Rightarrow;", "&#x021D2;", Rightarrow_code},
+        {sym_kind::ocr, "ne", "&ne;", "&#x02260;", ne_code},
+        {sym_kind::ocr, "neq", "&ne;", "&#x02260;", ne_code},
+        {sym_kind::ocr, "le", "&le;", "&#x02264;", le_code},
+        {sym_kind::ocr, "leq", "&le;", "&#x02264;", le_code},
+        {sym_kind::ocr, "ge", "&ge;", "&#x2265;", ge_code},
+        {sym_kind::ocr, "geq", "&ge;", "&#x2265;", ge_code},
+        {sym_kind::ocr, "succ", "&succ;", "&#x0227B;", succ_code},
+        {sym_kind::ocr, "approx", "&approx;", "&#x02248;", approx_code},
+        {sym_kind::ocr, "succeq", "&succeq;", "&#x02AB0;", succeq_code},
+        {sym_kind::ocr, "preceq", "&preceq;", "&#x02AAF;", preceq_code},
+        {sym_kind::ocr, "prec", "&prec;", "&#x0227A;", prec_code},
+        {sym_kind::ocr, "doteq", "&doteq;", "&#x02250;", doteq_code},
+        {sym_kind::ocr, "supset", "&supset;", "&#x02283;", supset_code},
+        {sym_kind::ocr, "subset", "&subset;", "&#x02282;", subset_code},
+        {sym_kind::ocr, "supseteq", "&supseteq;", "&#x02287;", supseteq_code},
+        {sym_kind::ocr, "subseteq", "&subseteq;", "&#x02286;", subseteq_code},
+        {sym_kind::ocr, "bindnasrepma", "&#x214B;", "&#x214B;", bindnasrepma_code},
+        {sym_kind::ocr, "ni", "&ni;", "&#x0220B;", ni_code},
+        {sym_kind::ocr, "owns", "&ni;", "&#x0220B;", ni_code},
+        {sym_kind::ocr, "gg", "&gg;", "&#x0226B;", gg_code},
+        {sym_kind::ocr, "ll", "&ll;", "&#x0226A;", ll_code},
+        {sym_kind::ocr, "gtrless", "&gl;", "&#x02277;", gtrless_code},
+        {sym_kind::ocr, "geqslant", "&geqslant;", "&#x02A7E;", geqslant_code},
+        {sym_kind::ocr, "leqslant", "&leqslant;", "&#x02A7D;", leqslant_code},
+        {sym_kind::ocr, "not", "&not;", "&#xAC;", not_code}, // pb
+        {sym_kind::ocr, "notin", "&notin;", "&#x02209;", notin_code},
+        {sym_kind::ocr, "leftrightarrow", "&leftrightarrow;", "&#x02194;", leftrightarrow_code},
+        {sym_kind::ocr, "leftarrow", "&leftarrow;", "&#x02190;", leftarrow_code},
+        {sym_kind::ocr, "gets", "&leftarrow;", "&#x02190;", leftarrow_code},
+        {sym_kind::ocr, "rightarrow", "&rightarrow;", "&#x02192;", rightarrow_code},
+        {sym_kind::ocr, "to", "&rightarrow;", "&#x02192;", rightarrow_code},
+        {sym_kind::ocr, "mapsto", "&mapsto;", "&#x021A6;", mapsto_code},
+        {sym_kind::ocr, "sim", "&sim;", "&#x0223C;", sim_code},
+        {sym_kind::ocr, "simeq", "&simeq;", "&#x02243;", simeq_code},
+        {sym_kind::ocr, "perp", "&perp;", "&#x022A5;", perp_code},
+        {sym_kind::ocr, "equiv", "&equiv;", "&#x02261;", equiv_code},
+        //  mk_ocr("asymp","&asymp;","&#x02248;",asymp_code);
+        {sym_kind::ocr, "asymp", "&asympeq;", "&#x0224D;", asymp_code},
+        {sym_kind::ocr, "smile", "&smile;", "&#x02323;", smile_code},
+        {sym_kind::ocr, "frown", "&frown;", "&#x02322;", frown_code},
+        {sym_kind::ocr, "leftharpoonup", "&leftharpoonup;", "&#x021BC;", leftharpoonup_code},
+        {sym_kind::ocr, "leftharpoondown", "&leftharpoondown;", "&#x021BD;", leftharpoondown_code},
+        {sym_kind::ocr, "rightharpoonup", "&rightharpoonup;", "&#x021C0;", rightharpoonup_code},
+        {sym_kind::ocr, "rightharpoondown", "&rightharpoondown;", "&#x021C1;", rightharpoondown_code},
+        {sym_kind::ocr, "hookrightarrow", "&hookrightarrow;", "&#x021AA;", hookrightarrow_code},
+        {sym_kind::ocr, "hookleftarrow", "&hookleftarrow;", "&#x021A9;", hookleftarrow_code},
+        {sym_kind::ocr, "bowtie", "&bowtie;", "&#x022C8;", bowtie_code},
+        {sym_kind::ocr, "Longrightarrow", "&Longrightarrow;", "&#x027F9;", Longrightarrow_code},
+        {sym_kind::ocr, "longrightarrow", "&longrightarrow;", "&#x027F6;", longrightarrow_code},
+        {sym_kind::ocr, "longleftarrow", "&longleftarrow;", "&#x027F5;", longleftarrow_code},
+        {sym_kind::ocr, "Longleftarrow", "&Longleftarrow;", "&#x027F8;", Longleftarrow_code},
+        // mk_ocr("longmapsto","&longmapsto;","&#x027FC;", longmapsto_code);
+        // variant
+        // mk_ocr("longmapsto","&longmapsto;","&#x21a4;", longmapsto_code);
+        {sym_kind::ocr, "longleftrightarrow", "&longleftrightarrow;", "&#x027F7;", longleftrightarrow_code},
+        {sym_kind::ocr, "Longleftrightarrow", "&Longleftrightarrow;", "&#x027FA;", Longleftrightarrow_code},
+        //  mk_ocr("iff","&iff;");   # merde
+        // mk_ocr("iff","&Longleftrightarrow;","&#x027FA;", iff_code);
+        {sym_kind::ocr, "iff", "&Leftrightarrow;", "&#x021D4;", iff_code},
+        {sym_kind::ocr, "backepsilon", "&backepsilon;", "&#x3F6;", backepsilon_code},
+        {sym_kind::ocr, "because", "&because;", "&#x2235;", because_code},
+        {sym_kind::ocr, "between", "&between;", "&#x226C;", between_code},
+        {sym_kind::ocr, "nmid", "&NotVerticalBar;", "&#x2224;", nmid_code},
+        {sym_kind::ocr, "nparallel", "&nparallel;", "&#x2226;", nparallel_code},
+        {sym_kind::ocr, "nVDash", "&nVDash;", "&#x22AF;", nVDash_code},
+        {sym_kind::ocr, "nvDash", "&nvDash;", "&#x22AD;", nvDash_code},
+        {sym_kind::ocr, "nVdash", "&nVdash;", "&#x22AE;", nVdash_code},
+        {sym_kind::ocr, "nvdash", "&nvdash;", "&#x22AC;", nvdash_code},
+        {sym_kind::ocr, "pitchfork", "&pitchfork;", "&#x22D4;", pitchfork_code},
+        {sym_kind::ocr, "therefore", "&therefore;", "&#x2234;", therefore_code},
+        {sym_kind::ocr, "nLeftarrow", "&nLeftarrow;", "&#x21CD;", nLeftarrow_code},
+        {sym_kind::ocr, "nLeftrightarrow", "&nLeftrightarrow;", "&#x21CE;", nLeftrightarrow_code},
+        {sym_kind::ocr, "nRightarrow", "&nRightarrow;", "&#x21CF;", nRightarrow_code},
+        {sym_kind::ocr, "nleftarrow", "&nleftarrow;", "&#x219A;", nleftarrow_code},
+        {sym_kind::ocr, "nleftrightarrow", "&nleftrightarrow;", "&#x21AE;", nleftrightarrow_code},
+        {sym_kind::ocr, "nrightarrow", "&nrightarrow;", "&#x219B;", nrightarrow_code},
+        {sym_kind::ocr, "approxeq", "&approxeq;", "&#x224A;", approxeq_code},
+        {sym_kind::ocr, "Subset", "&Subset;", "&#x22D0;", Subset_code},
+        {sym_kind::ocr, "Supset", "&Supset;", "&#x22D1;", Supset_code},
+        {sym_kind::ocr, "blacktriangleleft", "&blacktriangleleft;", "&#x25C2;", blacktriangleleft_code},
+        {sym_kind::ocr, "blacktriangleright", "&blacktriangleright;", "&#x25B8;", blacktriangleright_code},
+        {sym_kind::ocr, "triangledown", "&triangledown;", "&#x25BF;", triangledown_code},
+        {sym_kind::ocr, "circlearrowleft", "&#x2940;", "&#x2940;", circlearrowleft_code},
+        {sym_kind::ocr, "circlearrowright", "&#x2941;", "&#x2941;", circlearrowright_code},
+        {sym_kind::ocr, "curvearrowleft", "&#x293A;", "&#x293A;", curvearrowleft_code},
+        {sym_kind::ocr, "curvearrowright", "&#x293B;", "&#x293b;", curvearrowright_code},
+        {sym_kind::ocr, "dasharrow", "&rBarr;", "&#x290F;", dasharrow_code},
+        {sym_kind::ocr, "dashleftarrow", "&lBarr;", "&#x290E;", dashleftarrow_code},
+        {sym_kind::ocr, "dashrightarrow", "&rBarr;", "&#x290F;", dashrightarrow_code},
+        {sym_kind::ocr, "fatsemi", "&#x2A1F;", "&#x2A1F;", fatsemi_code},
+        {sym_kind::ocr, "downdownarrows", "&downdownarrows;", "&#x21CA;", downdownarrows_code},
+        {sym_kind::ocr, "downharpoonright", "&downharpoonright;", "&#x21C2;", downharpoonright_code},
+        {sym_kind::ocr, "downharpoonleft", "&downharpoonleft;", "&#x21C3;", downharpoonleft_code},
+        {sym_kind::ocr, "leftarrowtail", "&leftarrowtail;", "&#x21A2;", leftarrowtail_code},
+        {sym_kind::ocr, "rightarrowtail", "&rightarrowtail;", "&#x21A3;", rightarrowtail_code},
+        {sym_kind::ocr, "leftarrowtriangle", "&loarr;", "&#x21FD;", leftarrowtriangle_code},
+        {sym_kind::ocr, "rightarrowtriangle", "&roarr;", "&#x21FE;", rightarrowtriangle_code},
+        {sym_kind::ocr, "leftrightarrowtriangle", "&hoarr;", "&#x21FF;", leftrightarrowtriangle_code},
+        {sym_kind::ocr, "leftleftarrows", "&leftleftarrows;", "&#x21C7;", leftleftarrows_code},
+        {sym_kind::ocr, "upuparrows", "&upuparrows;", "&#x21C8;", upuparrows_code},
+        {sym_kind::ocr, "rightrightarrows", "&rightrightarrows;", "&#x21C9;", rightrightarrows_code},
+        {sym_kind::ocr, "leftrightarrows", "&leftrightarrows;", "&#x21C6;", leftrightarrows_code},
+        {sym_kind::ocr, "leftrightharpoons", "&leftrightharpoons;", "&#x21CB;", leftrightharpoons_code},
+        {sym_kind::ocr, "leftrightsquigarrow", "&leftrightsquigarrow;", "&#x21AD;", leftrightsquigarrow_code},
+        {sym_kind::ocr, "Lleftarrow", "&Lleftarrow;", "&#x21DA;", Lleftarrow_code},
+        {sym_kind::ocr, "Rrightarrow", "&Rrightarrow;", "&#x21DB;", Rrightarrow_code},
+        {sym_kind::ocr, "Longmapsfrom", "&#x27FD;", "&#x27FD;", Longmapsfrom_code},
+        {sym_kind::ocr, "longmapsfrom", "&#x27FB;", "&#x27FB;", longmapsfrom_code},
+        {sym_kind::ocr, "Mapsfrom", "&#x2906;", "&#x2906;", Mapsfrom_code},
+        {sym_kind::ocr, "Longmapsto", "&#x27FE;", "&#x27FE;", Longmapsto_code},
+        {sym_kind::ocr, "Mapsto", "&#x2907;", "&#x2907;", Mapsto_code},
+        {sym_kind::ocr, "mapsfrom", "&mapstoleft;", "&#x21A4;", mapsfrom_code},
+        {sym_kind::ocr, "longmapsto", "&longmapsto;", "&#x27FC;", longmapsto_code},
+        {sym_kind::ocr, "looparrowleft", "&looparrowleft;", "&#x21AB;", looparrowleft_code},
+        {sym_kind::ocr, "looparrowright", "&looparrowright;", "&#x21AC;", looparrowright_code},
+        {sym_kind::ocr, "Lsh", "&Lsh;", "&#x21B0;", Lsh_code},
+        {sym_kind::ocr, "Rsh", "&Rsh;", "&#x21B1;", Rsh_code},
+        {sym_kind::ocr, "rightleftarrows", "&rightleftarrows;", "&#x21C4;", rightleftarrows_code},
+        {sym_kind::ocr, "rightleftharpoons", "&rightleftharpoons;", "&#x21CC;", rightleftharpoons_code},
+        {sym_kind::ocr, "rightsquigarrow", "&rightsquigarrow;", "&#x21DD;", rightsquigarrow_code},
+        {sym_kind::ocr, "twoheadleftarrow", "&twoheadleftarrow;", "&#x219E;", twoheadleftarrow_code},
+        {sym_kind::ocr, "twoheadrightarrow", "&twoheadrightarrow;", "&#x21A0;", twoheadrightarrow_code},
+        {sym_kind::ocr, "upharpoonleft", "&upharpoonleft;", "&#x21BF;", upharpoonleft_code},
+        {sym_kind::ocr, "upharpoonright", "&upharpoonright;", "&#x21BE;", upharpoonright_code},
+        {sym_kind::ocr, "varprime", "&prime;", "&#x2032;", varprime_code}, // vprime in isoamso,
+        {sym_kind::ocr, "Prime", "&Prime;", "&#x2033;", Prime_code},
+        {sym_kind::ocr, "tprime", "&tprime;", "&#x2034;", tprime_code},
+        {sym_kind::ocr, "bprime", "&backprime;", "&#x2035;", bprime_code},
+        {sym_kind::ocr, "qprime", "&qprime;", "&#x2057;", qprime_code},
+        {sym_kind::ocr, "veebar", "&veebar;", "&#x22BB;", veebar_code},
+        {sym_kind::ocr, "backsimeq", "&backsimeq;", "&#x22CD;", backsimeq_code},
+        {sym_kind::ocr, "backsim", "&backsim;", "&#x223D;", backsim_code},
+        {sym_kind::ocr, "Bumpeq", "&Bumpeq;", "&#x224E;", Bumpeq_code},
+        {sym_kind::ocr, "bumpeq", "&bumpeq;", "&#x224F;", bumpeq_code},
+        {sym_kind::ocr, "circeq", "&circeq;", "&#x2257;", circeq_code},
+        {sym_kind::ocr, "curlyeqprec", "&curlyeqprec;", "&#x22DE;", curlyeqprec_code},
+        {sym_kind::ocr, "curlyeqsucc", "&curlyeqsucc;", "&#x22DF;", curlyeqsucc_code},
+        {sym_kind::ocr, "Doteq", "&doteqdot;", "&#x2251;", Doteq_code},
+        {sym_kind::ocr, "doteqdot", "&doteqdot;", "&#x2251;", doteqdot_code},
+        {sym_kind::ocr, "eqcirc", "&eqcirc;", "&#x2256;", eqcirc_code},
+        {sym_kind::ocr, "eqsim", "&eqsim;", "&#x2242;", eqsim_code},
+        {sym_kind::ocr, "eqslantgtr", "&eqslantgtr;", "&#x2A96;", eqslantgtr_code},
+        {sym_kind::ocr, "eqslantless", "&eqslantless;", "&#x2A95;", eqslantless_code},
+        {sym_kind::ocr, "fallingdotseq", "&fallingdotseq;", "&#x2252;", fallingdotseq_code},
+        {sym_kind::ocr, "risingdotseq", "&risingdotseq;", "&#x2253;", risingdotseq_code},
+        {sym_kind::ocr, "geqq", "&geqq;", "&#x2267;", geqq_code},
+        {sym_kind::ocr, "leqq", "&leqq;", "&#x2266;", leqq_code},
+        {sym_kind::ocr, "gggtr", "&ggg;", "&#x22D9;", gggtr_code},
+        {sym_kind::ocr, "ggg", "&ggg;", "&#x22D9;", ggg_code},
+        {sym_kind::ocr, "lll", "&Ll;", "&#x22D8;", lll_code},
+        {sym_kind::ocr, "llless", "&Ll;", "&#x22D8;", llless_code},
+        {sym_kind::ocr, "gtrapprox", "&gtrapprox;", "&#x2A86;", gtrapprox_code},
+        {sym_kind::ocr, "lessapprox", "&lessapprox;", "&#x2A85;", lessapprox_code},
+        {sym_kind::ocr, "gtreqless", "&gtreqless;", "&#x22DB;", gtreqless_code},
+        {sym_kind::ocr, "gtreqqless", "&gtreqqless;", "&#x2A8C;", gtreqqless_code},
+        {sym_kind::ocr, "lesseqgtr", "&lesseqgtr;", "&#x22DA;", lesseqgtr_code},
+        {sym_kind::ocr, "lesseqqgtr", "&lesseqqgtr;", "&#x2A8B;", lesseqqgtr_code},
+        {sym_kind::ocr, "lessgtr", "&lessgtr;", "&#x2276;", lessgtr_code},
+        {sym_kind::ocr, "lesssim", "&lesssim;", "&#x2272;", lesssim_code},
+        {sym_kind::ocr, "gtrsim", "&gtrsim;", "&#x2273;", gtrsim_code},
+        {sym_kind::ocr, "precapprox", "&precapprox;", "&#x2AB7;", precapprox_code},
+        {sym_kind::ocr, "succapprox", "&succapprox;", "&#x2AB8;", succapprox_code},
+        {sym_kind::ocr, "succcurlyeq", "&succcurlyeq;", "&#x227D;", succcurlyeq_code},
+        {sym_kind::ocr, "succsim", "&succsim;", "&#x227F;", succsim_code},
+        {sym_kind::ocr, "preccurlyeq", "&preccurlyeq;", "&#x227C;", preccurlyeq_code},
+        // mk_ocr("leftrightarroweq","&gtrsim;", "&#x2273;",leftrightarroweq_code);
+        {sym_kind::ocr, "gnapprox", "&gnapprox;", "&#x2A8A;", gnapprox_code},
+        {sym_kind::ocr, "lnapprox", "&lnapprox;", "&#x2A89;", lnapprox_code},
+        {sym_kind::ocr, "gneqq", "&gneqq;", "&#x2269;", gneqq_code},
+        {sym_kind::ocr, "lneqq", "&lneqq;", "&#x2268;", lneqq_code},
+        {sym_kind::ocr, "gneq", "&gneq;", "&#x2A88;", gneq_code},
+        {sym_kind::ocr, "lneq", "&lneq;", "&#x2A87;", lneq_code},
+        {sym_kind::ocr, "gnsim", "&gnsim;", "&#x22E7;", gnsim_code},
+        {sym_kind::ocr, "lnsim", "&lnsim;", "&#x22E6;", lnsim_code},
+        {sym_kind::ocr, "ngeq", "&ngeq;", "&#x2271;", ngeq_code},
+        {sym_kind::ocr, "ngtr", "&ngtr;", "&#x226F;", ngtr_code},
+        {sym_kind::ocr, "nleq", "&nleq;", "&#x2270;", nleq_code},
+        {sym_kind::ocr, "nless", "&nless;", "&#x226E;", nless_code},
+        {sym_kind::ocr, "nprec", "&nprec;", "&#x2280;", nprec_code},
+        {sym_kind::ocr, "nsim", "&nsim;", "&#x2241;", nsim_code},
+        {sym_kind::ocr, "nsucc", "&nsucc;", "&#x2281;", nsucc_code},
+        {sym_kind::ocr, "precnapprox", "&precnapprox;", "&#x2AB9;", precnapprox_code},
+        {sym_kind::ocr, "precneqq", "&precneqq;", "&#x2AB5;", precneqq_code},
+        {sym_kind::ocr, "precnsim", "&precnsim;", "&#x22E8;", precnsim_code},
+        {sym_kind::ocr, "precsim", "&precsim;", "&#x227E;", precsim_code},
+        {sym_kind::ocr, "succnapprox", "&succnapprox;", "&#x2ABA;", succnapprox_code},
+        {sym_kind::ocr, "succneqq", "&succneqq;", "&#x2AB6;", succneqq_code},
+        {sym_kind::ocr, "succnsim", "&succnsim;", "&#x22E9;", succnsim_code},
+        {sym_kind::ocr, "inplus", "&loplus;", "&#x2A2D;", inplus_code},
+        {sym_kind::ocr, "niplus", "&roplus;", "&#x2A2E;", niplus_code},
+        {sym_kind::ocr, "ntrianglerighteqslant", "&ntrianglerighteq;", "&#x22ED;", ntrianglerighteqslant_code},
+        {sym_kind::ocr, "ntrianglelefteqslant", "&ntrianglelefteq;", "&#x22EC;", ntrianglelefteqslant_code},
+        {sym_kind::ocr, "subseteqq", "&subseteqq;", "&#x2AC5;", subseteqq_code},
+        {sym_kind::ocr, "supseteqq", "&supseteqq;", "&#x2AC6;", supseteqq_code},
+        {sym_kind::ocr, "vartriangleleft", "&vartriangleleft;", "&#x22B2;", vartriangleleft_code},
+        {sym_kind::ocr, "vartriangleright", "&vartriangleright;", "&#x22B3;", vartriangleright_code},
+        {sym_kind::ocr, "trianglerighteq", "&trianglerighteq;", "&#x22B5;", trianglerighteq_code},
+        {sym_kind::ocr, "trianglelefteq", "&trianglelefteq;", "&#x22B4;", trianglelefteq_code},
+        {sym_kind::ocr, "nsubseteq", "&nsubseteq;", "&#x2288;", nsubseteq_code},
+        {sym_kind::ocr, "nsupseteq", "&nsupseteq;", "&#x2289;", nsupseteq_code},
+        {sym_kind::ocr, "ntrianglelefteq", "&ntrianglelefteq;", "&#x22EC;", ntrianglelefteq_code},
+        {sym_kind::ocr, "ntrianglerighteq", "&ntrianglerighteq;", "&#x22ED;", ntrianglerighteq_code},
+        {sym_kind::ocr, "ntriangleleft", "&ntriangleleft;", "&#x22EA;", ntriangleleft_code},
+        {sym_kind::ocr, "ntriangleright", "&ntriangleright;", "&#x22EB;", ntriangleright_code},
+        {sym_kind::ocr, "subsetneqq", "&subsetneqq;", "&#x2ACB;", subsetneqq_code},
+        {sym_kind::ocr, "supsetneqq", "&supsetneqq;", "&#x2ACC;", supsetneqq_code},
+        {sym_kind::ocr, "subsetneq", "&subsetneq;", "&#x228A;", subsetneq_code},
+        {sym_kind::ocr, "supsetneq", "&supsetneq;", "&#x228B;", supsetneq_code},
+
+        {sym_kind::oc, "rrbracket", "&RightDoubleBracket;", "&#x301B;", rrbracket_code},
+        {sym_kind::oc, "llbracket", "&LeftDoubleBracket;", "&#x301A;", llbracket_code},
+        {sym_kind::oc, "binampersand", "&amp;", "&amp;", binampersand_code},
+        // duplicate
+        {sym_kind::oc, "bindnasrepma", "&#x214B;", "&#x214B;", bindnasrepma_code},
+        {sym_kind::oc, "llparenthesis", "&#x2987;", "&#x2987;", llparenthesis_code},
+        {sym_kind::oc, "rrparenthesis", "&#x2988;", "&#x2988;", rrparenthesis_code},
+
+        // mk_oc("ldots","...");
+        {sym_kind::ocx, "cdots", "&ctdot;", "&#x022EF;", cdots_code, mathinner_cmd, false},
+        //  mk_oc("dots","&ctdot;");
+        {sym_kind::ocx, "hdots", "&ctdot;", "&#x022EF;", hdots_code, mathinner_cmd, false},
+        {sym_kind::ocx, "vdots", "&vellip;", "&#x022EE;", vdots_code, mathinner_cmd, false},
+        {sym_kind::ocx, "ddots", "&dtdot;", "&#x022F1;", ddots_code, mathinner_cmd, false},
+        {sym_kind::ocx, "imath", "&imath;", "&#x00131;", imath_code, mathord_cmd, false},
+        {sym_kind::ocx, "jmath", "&jmath;", "&#x0006A;", jmath_code, mathord_cmd, false},
+        {sym_kind::ocx, "@Vert", "&Verbar;", "&#x02016;", Vertx_code, mathbetween_cmd, false},
+        {sym_kind::ocx, "|", "&parallel;", "&#x02225;", Vert_code, mathbetween_cmd, false},
+        {sym_kind::ocx, "Vert", "&parallel;", "&#x02225;", Vert_code, mathbetween_cmd, false},
+        {sym_kind::ocx, "lVert", "&parallel;", "&#x02225;", Vert_code, mathopen_cmd, false},
+        {sym_kind::ocx, "rVert", "&parallel;", "&#x02225;", Vert_code, mathclose_cmd, false},
+        {sym_kind::ocx, "vert", "&vert;", "&#x7C;", vert_code, mathbetween_cmd, false},
+        {sym_kind::ocx, "lvert", "&vert;", "&#x7C;", vert_code, mathopen_cmd, false},
+        {sym_kind::ocx, "rvert", "&vert;", "&#x7C;", vert_code, mathclose_cmd, false},
+        {sym_kind::ocx, "uparrow", "&uparrow;", "&#x02191;", uparrow_code, mathbetween_cmd, true},
+        {sym_kind::ocx, "downarrow", "&downarrow;", "&#x02193;", downarrow_code, mathbetween_cmd, true},
+        {sym_kind::ocx, "Uparrow", "&Uparrow;", "&#x021D1;", Uparrow_code, mathbetween_cmd, true},
+        {sym_kind::ocx, "Downarrow", "&Downarrow;", "&#x021D3;", Downarrow_code, mathbetween_cmd, true},
+        {sym_kind::ocx, "Updownarrow", "&Updownarrow;", "&#x021D5;", Updownarrow_code, mathbetween_cmd, true},
+        {sym_kind::ocx, "updownarrow", "&updownarrow;", "&#x02195;", updownarrow_code, mathbetween_cmd, true},
+        {sym_kind::ocx, "backslash", "&Backslash;", "&#x2216;", backslash_code, mathbetween_cmd, false},
+        {sym_kind::oc, "mho", "&mho;", "&#x02127;", mho_code},
+        {sym_kind::oc, "DifferentialD", "&DifferentialD;", "&#x2146;", differentiald_code},
+        {sym_kind::oc, "leadsto", "&#x21DD;", "&#x21DD;", leadsto_code},
+        {sym_kind::oc, "lhd", "&#x22B2;", "&#x22B2;", lhd_code},
+        {sym_kind::oc, "rhd", "&#x22B3;", "&#x22B3;", rhd_code},
+        {sym_kind::oc, "unlhd", "&#x22B4;", "&#x22B4;", unlhd_code},
+        {sym_kind::oc, "unrhd", "&#x22B5;", "&#x22B5;", unrhd_code},
+        {sym_kind::oc, "clubsuit", "&clubsuit;", "&#x02663;", clubsuit_code},
+        {sym_kind::oc, "diamondsuit", "&diamondsuit;", "&#x02666;", diamondsuit_code},
+        {sym_kind::oc, "heartsuit", "&heartsuit;", "&#x02665;", heartsuit_code},
+        {sym_kind::oc, "spadesuit", "&spadesuit;", "&#x02660;", spadesuit_code},
+        {sym_kind::oc, "Box", "&#x25A1;", "&#x25A1;", Box_code},
+        {sym_kind::ocx, "rangle", "&rangle;", RANGLE, rangle_code, mathclose_cmd, true},
+        {sym_kind::ocx, "langle", "&langle;", LANGLE, langle_code, mathopen_cmd, true},
+        {sym_kind::ocx, "varrangle", "&rangle;", "&#x27E9;", varrangle_code, mathclose_cmd, false},
+        {sym_kind::ocx, "varlangle", "&langle;", "&#x27E8;", varlangle_code, mathopen_cmd, false},
+        {sym_kind::ocx, "rmoustache", "&rmoustache;", "&#x023B1;", rmoustache_code, mathclose_cmd, false},
+        {sym_kind::ocx, "lmoustache", "&lmoustache;", "&#x023B0;", lmoustache_code, mathopen_cmd, false},
+        {sym_kind::ocx, "rgroup", "&#x3015;", "&#x3015;", rgroup_code, mathclose_cmd, false},
+        {sym_kind::ocx, "lgroup", "&#x3014;", "&#x3014;", lgroup_code, mathopen_cmd, false},
+        {sym_kind::ocx, "rbrace", "&rbrace;", "&#x0007D;", rbrace_code, mathclose_cmd, true},
+        {sym_kind::ocx, "lbrace", "&lbrace;", "&#x0007B;", lbrace_code, mathopen_cmd, true},
+        {sym_kind::ocx, "lceil", "&lceil;", "&#x02308;", lceil_code, mathopen_cmd, false},
+        {sym_kind::ocx, "rceil", "&rceil;", "&#x02309;", rceil_code, mathclose_cmd, false},
+        {sym_kind::ocx, "lfloor", "&lfloor;", "&#x0230A;", lfloor_code, mathopen_cmd, false},
+        {sym_kind::ocx, "rfloor", "&rfloor;", "&#x0230B;", rfloor_code, mathclose_cmd, false},
+
+        {sym_kind::oc, "square", "&square;", "&#x025A1;", square_code},
+        {sym_kind::oc, "cong", "&cong;", "&#x02245;", cong_code},
+        {sym_kind::oc, "ncong", "&#x2247;", "&#x02247;", ncong_code},
+        {sym_kind::oc, "lnot", "&not;", "&#xAC;", not_code},
+
+        {sym_kind::ocb, "in", "&Element;", "&#x02208;", in_code},
+    }};
+} // namespace
+
+// Defines all commands from the math_symbols table.
+void MathDataP::boot_symbols() {
+    for (const auto &s : math_symbols) {
+        switch (s.kind) {
+        case sym_kind::ic: mk_ic(s.name, s.ent, s.ent2, s.pos); break;
+        case sym_kind::icb: mk_icb(s.name, s.ent, s.ent2, s.pos); break;
+        case sym_kind::oc: mk_oc(s.name, s.ent, s.ent2, s.pos); break;
+        case sym_kind::ocx: mk_oc(s.name, s.ent, s.ent2, s.pos, s.t, s.hack); break;
+        case sym_kind::oco: mk_oco(s.name, s.ent, s.ent2, s.pos); break;
+        case sym_kind::ocol: mk_ocol(s.name, s.ent, s.ent2, s.pos); break;
+        case sym_kind::ocb: mk_ocb(s.name, s.ent, s.ent2, s.pos); break;
+        case sym_kind::ocr: mk_ocr(s.name, s.ent, s.ent2, s.pos); break;
+        case sym_kind::moo: mk_moo(s.name, s.ent, s.pos); break;
+        }
+    }
+}
+
 void MathDataP::boot() {
     no_ent_names = the_main.no_entnames;
     boot_table();
@@ -1398,536 +1955,12 @@ void MathDataP::boot() {
 
     Dispatcher::boot(); // \todo move to a more reasonable and robust place
 
-    mk_icb("alpha", "&alpha;", "&#x3B1;", alpha_code);
-    mk_icb("beta", "&beta;", "&#x3B2;", beta_code);
-    mk_icb("gamma", "&gamma;", "&#x3B3;", gamma_code);
-    mk_icb("delta", "&delta;", "&#x3B4;", delta_code);
-    mk_icb("epsilon", "&straightepsilon;", "&#x3F5;", epsilon_code);
-    mk_icb("varepsilon", "&varepsilon;", "&#x3B5;", varepsilon_code);
-    mk_icb("zeta", "&zeta;", "&#x3B6;", zeta_code);
-    mk_icb("eta", "&eta;", "&#x3B7;", eta_code);
-    mk_icb("theta", "&theta;", "&#x3B8;", theta_code);
-    mk_icb("iota", "&iota;", "&#x3B9;", iota_code);
-    mk_icb("kappa", "&kappa;", "&#x3BA;", kappa_code);
-    mk_icb("lambda", "&lambda;", "&#x3BB;", lambda_code);
-    mk_icb("mu", "&mu;", "&#x3BC;", mu_code);
-    mk_icb("nu", "&nu;", "&#x3BD;", nu_code);
-    mk_icb("xi", "&xi;", "&#x3BE;", xi_code);
-    mk_icb("pi", "&pi;", "&#x3C0;", pi_code);
-    mk_icb("rho", "&rho;", "&#x3C1;", rho_code);
-    mk_icb("sigma", "&sigma;", "&#x3C3;", sigma_code);
-    mk_icb("tau", "&tau;", "&#x3C4;", tau_code);
-    mk_icb("upsilon", "&upsi;", "&#x3C5;", upsilon_code);
-    mk_icb("phi", "&phi;", "&#x3C6;", phi_code);
-    mk_icb("varphi", "&phiv;", "&#x3D5;", varphi_code);
-    mk_icb("chi", "&chi;", "&#x3C7;", chi_code);
-    mk_icb("psi", "&psi;", "&#x3C8;", psi_code);
-    mk_icb("omega", "&omega;", "&#x3C9;", omega_code);
-    mk_icb("digamma", "&digamma;", "&#x3DD;", digamma_code);
-    mk_icb("varpi", "&piv;", "&#x3D6;", varpi_code);
-    mk_icb("varrho", "&rhov;", "&#x3F1;", varrho_code);
-    mk_icb("varsigma", "&sigmav;", "&#x3C2;", varsigma_code);
-    mk_icb("vartheta", "&thetav;", "&#x3D1;", vartheta_code);
-    mk_icb("varkappa", "&kappav;", "&#x3F0;", varkappa_code);
-    mk_icb("Gamma", "&Gamma;", "&#x393;", Gamma_code);
-    mk_icb("Delta", "&Delta;", "&#x394;", Delta_code);
-    mk_icb("Theta", "&Theta;", "&#x398;", Theta_code);
-    mk_icb("Lambda", "&Lambda;", "&#x39B;", Lambda_code);
-    mk_icb("Xi", "&Xi;", "&#x39E;", Xi_code);
-    mk_icb("Sigma", "&Sigma;", "&#x3A3;", Sigma_code);
-    mk_icb("Upsilon", "&Upsi;", "&#x3A5;", Upsilon_code);
-    mk_icb("Phi", "&Phi;", "&#x3A6;", Phi_code);
-    mk_icb("Pi", "&Pi;", "&#x3A0;", Pi_code);
-    mk_icb("Psi", "&Psi;", "&#x3A8;", Psi_code);
-    mk_icb("Omega", "&Omega;", "&#x3A9;", Omega_code);
-    mk_ic("hbar", "&#x127;", "&#x127;", hbar_code);
-    mk_ic("hslash", "&hbar;", "&#x0210F;", hbar_code);
-    mk_ic("ell", "&ell;", "&#x02113;", ell_code); // pb
-    mk_ic("wp", "&wp;", "&#x02118;", wp_code);
-    mk_ic("Re", "&Re;", "&#x0211C;", Re_code);
-    mk_ic("Im", "&Im;", "&#x02111;", Im_code);
-
-    // Other mi alphabetic order
-    mk_ic("aleph", "&aleph;", "&#x02135;", aleph_code);
-    mk_ic("angle", "&ang;", "&#x02220;", angle_code);
-    mk_ic("backprime", "&backprime;", "&#x2035;", backprime_code);
-    mk_ic("beth", "&beth;", "&#x02136;", beth_code);
-    mk_ic("bigstar", "&bigstar;", "&#x2605;", bigstar_code);
-    mk_ic("blacklozenge", "&blacklozenge;", "&#x29EB;", blacklozenge_code);
-    mk_ic("blacksquare", "&blacksquare;", "&#x25AA;", blacksquare_code);
-    mk_ic("blacktriangledown", "&blacktriangledown;", "&#x25BE;", blacktriangledown_code);
-    mk_ic("blacktriangle", "&blacktriangle;", "&#x25B4;", blacktriangle_code);
-    mk_ic("bot", "&bottom;", "&#x022A5;", bot_code);
-    mk_ic("bottom", "&bottom;", "&#x022A5;", bottom_code); // eval_let ?????
-    mk_ic("circledS", "&circledS;", "&#x24C8;", circledS_code);
-    mk_ic("complement", "&complement;", "&#x02201;", complement_code);
-    mk_ic("daleth", "&daleth;", "&#x2138;", daleth_code);
-    mk_ic("diagdown", "&setminus;", "&#x2216;", diagdown_code);
-    mk_ic("diagup", "&#x2215;", "&#x2215;", diagup_code);
-    mk_ic("emptyset", "&emptyset;", "&#x2205;", emptyset_code);
-    mk_ic("eth", "&eth;", "&#xF0;", eth_code);
-    mk_ic("ExponentialE", "&ExponentialE;", "&#x2147;", exponentiale_code);
-    mk_ic("Finv", "&#x2132;", "&#x2132;", Finv_code);
-    mk_ic("Game", "&#x2141;", "&#x2141;", Game_code);
-    mk_ic("gimel", "&gimel;", "&#x2137;", gimel_code);
-    mk_ic("ImaginaryI", "&ImaginaryI;", "&#x2148;", imaginaryi_code);
-    mk_ic("infty", "&infin;", "&#x0221E;", infty_code);
-    mk_ic("lightning", "&#x2607;", "&#x2607;", lightning_code);
-    mk_ic("lozenge", "&lozenge;", "&#x25CA;", lozenge_code);
-    mk_ic("nabla", "&nabla;", "&#x02207;", nabla_code);
-    mk_ic("measuredangle", "&measuredangle;", "&#x2221;", measuredangle_code);
-    mk_ic("mathparagraph", "&para;", "&#xB6;", mathparagraph_code);
-    mk_ic("mathsection", "&sect;", "&#xA7;", mathsection_code);
-    mk_ic("partial", "&part;", "&#x02202;", partial_code);
-    mk_ic("nexists", "&nexists;", "&#x02204;", nexists_code);
-    mk_ic("surd", "&radic;", "&#x0221A;", surd_code);
-    mk_ic("sphericalangle", "&angsph;", "&#x2222;", sphericalangle_code);
-    mk_ic("top", "&top;", "&#x022A4;", top_code);
-    mk_ic("triangle", "&triangle;", "&#x025B5;", triangle_code);
-    mk_ic("varnothing", "&#x2300;", "&#x2300;", varnothing_code);
-
-    // mathop rm.. alphabetic order
-    mk_moo("arccos", "arccos", arccos_code);
-    mk_moo("arcsin", "arcsin", arcsin_code);
-    mk_moo("arctan", "arctan", arctan_code);
-    mk_moo("arg", "arg", arg_code);
-    mk_moo("cos", "cos", cos_code);
-    mk_moo("cosh", "cosh", cosh_code);
-    mk_moo("cot", "cot", cot_code);
-    mk_moo("coth", "coth", coth_code);
-    mk_moo("csc", "csc", csc_code);
-    mk_moo("deg", "deg", deg_code);
-    mk_moo("det", "det", det_code);
-    mk_moo("dim", "dim", dim_code);
-    mk_moo("exp", "exp", exp_code);
-    mk_moo("gcd", "gcd", gcd_code);
-    mk_moo("hom", "hom", hom_code);
-    mk_moo("inf", "inf", inf_code);
-    mk_moo("injlim", "inj lim", injlim_code);
-    mk_moo("ker", "ker", ker_code);
-    mk_moo("lg", "lg", lg_code);
-    mk_moo("lim", "lim", lim_code);
-    mk_moo("liminf", "lim inf", liminf_code);
-    mk_moo("limsup", "lim sup", limsup_code);
-    mk_moo("ln", "ln", ln_code);
-    mk_moo("log", "log", log_code);
-    mk_moo("max", "max", max_code);
-    mk_moo("min", "min", min_code);
-    mk_moo("Pr", "Pr", Pr_code);
-    mk_moo("projlim", "proj lim", projlim_code);
-    mk_moo("sec", "sec", sec_code);
-    mk_moo("sin", "sin", sin_code);
-    mk_moo("@mod", "mod", mod_code);
-    mk_moo("sinh", "sinh", sinh_code);
-    mk_moo("sup", "sup", sup_code);
-    mk_moo("tan", "tan", tan_code);
-    mk_moo("tanh", "tanh", tanh_code);
-
-    mk_oc("forall", "&forall;", "&#x02200;", forall_code);
-    mk_oc("exists", "&exist;", "&#x02203;", exists_code);
-
-    // type large
-    mk_ocol("coprod", "&coprod;", "&#x02210;", coprod_code);
-    mk_ocol("bigvee", "&bigvee;", "&#x022C1;", bigvee_code);       // pb
-    mk_ocol("bigwedge", "&bigwedge;", "&#x022C0;", bigwedge_code); // pb
-    mk_ocol("biguplus", "&uplus;", "&#x0228E;", biguplus_code);
-    mk_ocol("bigcap", "&bigcap;", "&#x022C2;", bigcap_code);
-    mk_ocol("bigcup", "&bigcup;", "&#x022C3;", bigcup_code);
-    mk_oco("int", "&int;", "&#x0222B;", int_code);
-    mk_oco("xiint", "&#x0222C;", "&#x0222C;", xiint_code);
-    mk_oco("xiiint", "&iiint;", "&#x0222D;", xiiint_code);
-    mk_oco("xiiiint", "&iiiint;", "&#x02A0C;", xiiiint_code);
-    mk_ocol("sum", "&sum;", "&#x02211;", sum_code);
-    mk_ocol("prod", "&prod;", "&#x0220F;", prod_code);
-    mk_ocol("bigotimes", "&bigotimes;", "&#x02A02;", bigotimes_code);
-    mk_ocol("bigoplus", "&bigoplus;", "&#x02A01;", bigoplus_code);
-    mk_ocol("bigodot", "&bigodot;", "&#x02A00;", bigodot_code);
-    mk_oco("oint", "&oint;", "&#x0222E;", oint_code);
-    mk_ocol("bigsqcup", "&bigsqcup;", "&#x02A06;", bigsqcup_code);
-    mk_oco("smallint", "&int;", "&#x0222B;", smallint_code); // pas de small...
-
-    // type bin
-    mk_ocb("triangleq", "&triangleq;", "&#x0225C;", triangleq_code);
-    mk_ocb("triangleleft", "&triangleleft;", "&#x025C3;", triangleleft_code);
-    mk_ocb("triangleright", "&triangleright;", "&#x025B9;", triangleright_code);
-    mk_ocb("bigtriangleup", "&bigtriangleup;", "&#x025B3;", bigtriangleup_code);
-    mk_ocb("bigtriangledown", "&bigtriangledown;", "&#x025BD;", bigtriangledown_code);
-    mk_ocb("wedge", "&wedge;", "&#x02227;", wedge_code);
-    mk_ocb("land", "&wedge;", "&#x02227;", wedge_code);
-    mk_ocb("vee", "&vee;", "&#x02228;", vee_code);
-    mk_ocb("lor", "&vee;", "&#x02228;", vee_code);
-    mk_ocb("cap", "&cap;", "&#x02229;", cap_code);
-    mk_ocb("cup", "&cup;", "&#x0222A;", cup_code);
-    mk_ocb("Cap", "&Cap;", "&#x022D2;", Cap_code);
-    mk_ocb("Cup", "&Cup;", "&#x022D3;", Cup_code);
-    mk_ocb("multimap", "&multimap;", "&#x022B8;", multimap_code);
-    mk_ocb("dagger", "&dagger;", "&#x02020;", dagger_code);
-    mk_ocb("ddagger", "&ddagger;", "&#x02021;", ddagger_code);
-    mk_ocb("sqcap", "&sqcap;", "&#x02293;", sqcap_code);
-    mk_ocb("sqcup", "&sqcup;", "&#x02294;", sqcup_code);
-    mk_ocb("amalg", "&amalg;", "&#x02A3F;", almalg_code);
-    mk_ocb("diamond", "&diamond;", "&#x022C4;", diamand_code);
-    mk_ocb("Diamond", "&diamond;", "&#x022C4;", Diamond_code);
-    mk_ocb("bullet", "&bullet;", "&#x02022;", bullet_code);
-    mk_ocb("wr", "&wr;", "&#x02240;", wr_code);
-    mk_ocb("div", "&div;", "&#xF7;", div_code);
-    mk_ocb("odot", "&odot;", "&#x02299;", odot_code);
-    mk_ocb("oslash", "&osol;", "&#x02298;", oslash_code);
-    mk_ocb("otimes", "&otimes;", "&#x02297;", otimes_code);
-    mk_ocb("ominus", "&ominus;", "&#x02296;", ominus_code);
-    mk_ocb("oplus", "&oplus;", "&#x02295;", oplus_code);
-    mk_ocb("uplus", "&uplus;", "&#x0228E;", uplus_code);
-    mk_ocb("mp", "&mp;", "&#x02213;", mp_code);
-    mk_ocb("pm", "&pm;", "&#xB1;", pm_code);
-    mk_ocb("circ", "&SmallCircle;", "&#x02218;", circ_code);   // pb
-    mk_ocb("bigcirc", "&bigcirc;", "&#x025EF;", bigcirc_code); // pb
-    mk_ocb("setminus", "&setminus;", "&#x02216;", setminus_code);
-    mk_ocb("cdot", "&middot;", "&#xB7;", cdot_code); // pb
-    mk_ocb("ast", "&ast;", "&#x2A;", ast_code);
-    mk_ocb("times", "&times;", "&#xD7;", times_code);
-    mk_ocb("star", "&star;", "&#x02606;", star_code);
-    mk_ocb("*", "&InvisibleTimes;", "&#x02062;", starchar_code);
-    mk_ocb("InvisibleTimes", "&InvisibleTimes;", "&#x2062;", starchar_code);
-    mk_ocb("ApplyFunction", "&ApplyFunction;", "&#x2061;", applyfct_code);
-    mk_ocb("InvisibleComma", "&InvisibleComma;", "&#x2063;", invisiblecomma_code);
-    mk_ocb("baro", "&ovbar;", "&#x233D;", baro_code);
-    mk_ocb("barwedge", "&#x22BC;", "&#x22BC;", barwedge_code);
-    mk_ocb("curlyvee", "&curlyvee;", "&#x22CE;", curlyvee_code);
-    mk_ocb("curlywedge", "&curlywedge;", "&#x22CF;", curlywedge_code);
-    mk_ocb("divideontimes", "&divideontimes;", "&#x22C7;", divideontimes_code);
-    mk_ocb("dotplus", "&dotplus;", "&#x2214;", dotplus_code);
-    mk_ocb("gtrdot", "&gtrdot;", "&#x22D7;", gtrdot_code);
-    mk_ocb("intercal", "&intercal;", "&#x22BA;", intercal_code);
-    mk_ocb("interleave", "&#x2AF4;", "&#x2AF4;", interleave_code);
-    mk_ocb("leftslice", "&#x2AA6;", "&#x2AA6;", leftslice_code);
-    mk_ocb("rightslice", "&#x2AA7;", "&#x2AA7;", rightslice_code);
-    mk_ocb("leftthreetimes", "&leftthreetimes;", "&#x22CB;", leftthreetimes_code);
-    mk_ocb("rightthreetimes", "&rightthreetimes;", "&#x22CC;", rightthreetimes_code);
-    mk_ocb("lessdot", "&lessdot;", "&#x22D6;", lessdot_code);
-    mk_ocb("ltimes", "&ltimes;", "&#x22C9;", ltimes_code);
-    mk_ocb("rtimes", "&rtimes;", "&#x22CA;", rtimes_code);
-    mk_ocb("merge", "&#x2A07;", "&#x2A07;", merge_code);
-    mk_ocb("sslash", "&#x2AFD;", "&#x2AFD;", sslash_code);
-    mk_ocb("talloblong", "&#x2AFF;", "&#x2AFF;", talloblong_code);
-    mk_ocb("boxast", "&#x29C6;", "&#x29C6;", boxast_code);
-    mk_ocb("boxbox", "&#x29C8;", "&#x29C8;", boxbox_code);
-    mk_ocb("boxbslash", "&bsolb;", "&#x29C5;", boxbslash_code);
-    mk_ocb("boxcircle", "&#x29C7;", "&#x29C7;", boxcircle_code);
-    mk_ocb("boxdot", "&dotsquare;", "&#x22A1;", boxdot_code);
-    mk_ocb("boxminus", "&boxminus;", "&#x229F;", boxminus_code);
-    mk_ocb("boxplus", "&boxplus;", "&#x229E;", boxplus_code);
-    mk_ocb("boxslash", "&solb;", "&#x29C4;", boxslash_code);
-    mk_ocb("boxtimes", "&boxtimes;", "&#x22A0;", boxtimes_code);
-    mk_ocb("centerdot", "&sdot;", "&#x22C5;", centerdot_code);
-    mk_ocb("circledast", "&circledast;", "&#x229B;", circledast_code);
-    mk_ocb("circledcirc", "&circledcirc;", "&#x229A;", circledcirc_code);
-    mk_ocb("circleddash", "&circleddash;", "&#x229D;", circleddash_code);
-    mk_ocb("obar", "&omid;", "&#x29B6;", obar_code);
-    mk_ocb("ogreaterthan", "&ogt;", "&#x29C1;", ogreaterthan_code);
-    mk_ocb("olessthan", "&olt;", "&#x29C0;", olessthan_code);
-    mk_ocb("varocircle", "&#x29BE;", "&#x29BE;", varocircle_code);
-
-    // Rel
-    mk_ocr("propto", "&propto;", "&#x0221D;", propto_code);
-    mk_ocr("sqsubseteq", "&sqsubseteq;", "&#x02291;", sqsubseteq_code);
-    mk_ocr("sqsupseteq", "&sqsupseteq;", "&#x02292;", sqsupseteq_code);
-    mk_ocr("sqsubset", "&sqsubset;", "&#x0228F;", sqsubset_code);
-    mk_ocr("sqsupset", "&sqsupset;", "&#x02290;", sqsupset_code);
-    mk_ocr("parallel", "&parallel;", "&#x02225;", parallel_code);
-    mk_ocr("mid", "&mid;", "&#x02223;", mid_code);
-    mk_ocr("dashv", "&dashv;", "&#x022A3;", dashv_code);
-    mk_ocr("vdash", "&vdash;", "&#x022A2;", vdash_code);
-    mk_ocr("Vdash", "&Vdash;", "&#x022A9;", Vdash_code);
-    mk_ocr("vDash", "&vDash;", "&#x22A7;", vDash_code);
-    mk_ocr("VDash", "&VDash;", "&#x22AB;", VDash_code);
-    mk_ocr("Vvdash", "&Vvdash;", "&#x22AA;", Vvdash_code);
-    mk_ocr("models", "&models;", "&#x022A7;", models_code);
-    mk_ocr("nearrow", "&nearrow;", "&#x02197;", nearrow_code);
-    mk_ocr("searrow", "&searrow;", "&#x02198;", searrow_code);
-    mk_ocr("nwarrow", "&nwarrow;", "&#x02196;", nwarrow_code);
-    mk_ocr("swarrow", "&swarrow;", "&#x02199;", swarrow_code);
-    mk_ocr("Leftrightarrow", "&Leftrightarrow;", "&#x021D4;", Leftrightarrow_code);
-    mk_ocr("Leftarrow", "&Leftarrow;", "&#x021D0;", Leftarrow_code);
-    mk_ocr("Rightarrow", "&Rightarrow;", "&#x021D2;", Rightarrow_code);
-    mk_ocr("implies", "&Rightarrow;", "&#x021D2;", Rightarrow_code);
-    mk_ocr("ne", "&ne;", "&#x02260;", ne_code);
-    mk_ocr("neq", "&ne;", "&#x02260;", ne_code);
-    mk_ocr("le", "&le;", "&#x02264;", le_code);
-    mk_ocr("leq", "&le;", "&#x02264;", le_code);
-    mk_ocr("ge", "&ge;", "&#x2265;", ge_code);
-    mk_ocr("geq", "&ge;", "&#x2265;", ge_code);
-    mk_ocr("succ", "&succ;", "&#x0227B;", succ_code);
-    mk_ocr("approx", "&approx;", "&#x02248;", approx_code);
-    mk_ocr("succeq", "&succeq;", "&#x02AB0;", succeq_code);
-    mk_ocr("preceq", "&preceq;", "&#x02AAF;", preceq_code);
-    mk_ocr("prec", "&prec;", "&#x0227A;", prec_code);
-    mk_ocr("doteq", "&doteq;", "&#x02250;", doteq_code);
-    mk_ocr("supset", "&supset;", "&#x02283;", supset_code);
-    mk_ocr("subset", "&subset;", "&#x02282;", subset_code);
-    mk_ocr("supseteq", "&supseteq;", "&#x02287;", supseteq_code);
-    mk_ocr("subseteq", "&subseteq;", "&#x02286;", subseteq_code);
-    mk_ocr("bindnasrepma", "&#x214B;", "&#x214B;", bindnasrepma_code);
-    mk_ocr("ni", "&ni;", "&#x0220B;", ni_code);
-    mk_ocr("owns", "&ni;", "&#x0220B;", ni_code);
-    mk_ocr("gg", "&gg;", "&#x0226B;", gg_code);
-    mk_ocr("ll", "&ll;", "&#x0226A;", ll_code);
-    mk_ocr("gtrless", "&gl;", "&#x02277;", gtrless_code);
-    mk_ocr("geqslant", "&geqslant;", "&#x02A7E;", geqslant_code);
-    mk_ocr("leqslant", "&leqslant;", "&#x02A7D;", leqslant_code);
-    mk_ocr("not", "&not;", "&#xAC;", not_code); // pb
-    mk_ocr("notin", "&notin;", "&#x02209;", notin_code);
-    mk_ocr("leftrightarrow", "&leftrightarrow;", "&#x02194;", leftrightarrow_code);
-    mk_ocr("leftarrow", "&leftarrow;", "&#x02190;", leftarrow_code);
-    mk_ocr("gets", "&leftarrow;", "&#x02190;", leftarrow_code);
-    mk_ocr("rightarrow", "&rightarrow;", "&#x02192;", rightarrow_code);
-    mk_ocr("to", "&rightarrow;", "&#x02192;", rightarrow_code);
-    mk_ocr("mapsto", "&mapsto;", "&#x021A6;", mapsto_code);
-    mk_ocr("sim", "&sim;", "&#x0223C;", sim_code);
-    mk_ocr("simeq", "&simeq;", "&#x02243;", simeq_code);
-    mk_ocr("perp", "&perp;", "&#x022A5;", perp_code);
-    mk_ocr("equiv", "&equiv;", "&#x02261;", equiv_code);
-    //  mk_ocr("asymp","&asymp;","&#x02248;",asymp_code);
-    mk_ocr("asymp", "&asympeq;", "&#x0224D;", asymp_code);
-    mk_ocr("smile", "&smile;", "&#x02323;", smile_code);
-    mk_ocr("frown", "&frown;", "&#x02322;", frown_code);
-    mk_ocr("leftharpoonup", "&leftharpoonup;", "&#x021BC;", leftharpoonup_code);
-    mk_ocr("leftharpoondown", "&leftharpoondown;", "&#x021BD;", leftharpoondown_code);
-    mk_ocr("rightharpoonup", "&rightharpoonup;", "&#x021C0;", rightharpoonup_code);
-    mk_ocr("rightharpoondown", "&rightharpoondown;", "&#x021C1;", rightharpoondown_code);
-    mk_ocr("hookrightarrow", "&hookrightarrow;", "&#x021AA;", hookrightarrow_code);
-    mk_ocr("hookleftarrow", "&hookleftarrow;", "&#x021A9;", hookleftarrow_code);
-    mk_ocr("bowtie", "&bowtie;", "&#x022C8;", bowtie_code);
+    boot_symbols();
     eval_let("Join", "bowtie");
-    mk_ocr("Longrightarrow", "&Longrightarrow;", "&#x027F9;", Longrightarrow_code);
-    mk_ocr("longrightarrow", "&longrightarrow;", "&#x027F6;", longrightarrow_code);
-    mk_ocr("longleftarrow", "&longleftarrow;", "&#x027F5;", longleftarrow_code);
-    mk_ocr("Longleftarrow", "&Longleftarrow;", "&#x027F8;", Longleftarrow_code);
-    // mk_ocr("longmapsto","&longmapsto;","&#x027FC;", longmapsto_code);
-    // variant
-    // mk_ocr("longmapsto","&longmapsto;","&#x21a4;", longmapsto_code);
-    mk_ocr("longleftrightarrow", "&longleftrightarrow;", "&#x027F7;", longleftrightarrow_code);
-    mk_ocr("Longleftrightarrow", "&Longleftrightarrow;", "&#x027FA;", Longleftrightarrow_code);
-    //  mk_ocr("iff","&iff;");   # merde
-    // mk_ocr("iff","&Longleftrightarrow;","&#x027FA;", iff_code);
-    mk_ocr("iff", "&Leftrightarrow;", "&#x021D4;", iff_code);
-    mk_ocr("backepsilon", "&backepsilon;", "&#x3F6;", backepsilon_code);
-    mk_ocr("because", "&because;", "&#x2235;", because_code);
-    mk_ocr("between", "&between;", "&#x226C;", between_code);
-    mk_ocr("nmid", "&NotVerticalBar;", "&#x2224;", nmid_code);
-    mk_ocr("nparallel", "&nparallel;", "&#x2226;", nparallel_code);
-    mk_ocr("nVDash", "&nVDash;", "&#x22AF;", nVDash_code);
-    mk_ocr("nvDash", "&nvDash;", "&#x22AD;", nvDash_code);
-    mk_ocr("nVdash", "&nVdash;", "&#x22AE;", nVdash_code);
-    mk_ocr("nvdash", "&nvdash;", "&#x22AC;", nvdash_code);
-    mk_ocr("pitchfork", "&pitchfork;", "&#x22D4;", pitchfork_code);
-    mk_ocr("therefore", "&therefore;", "&#x2234;", therefore_code);
-    mk_ocr("nLeftarrow", "&nLeftarrow;", "&#x21CD;", nLeftarrow_code);
-    mk_ocr("nLeftrightarrow", "&nLeftrightarrow;", "&#x21CE;", nLeftrightarrow_code);
-    mk_ocr("nRightarrow", "&nRightarrow;", "&#x21CF;", nRightarrow_code);
-    mk_ocr("nleftarrow", "&nleftarrow;", "&#x219A;", nleftarrow_code);
-    mk_ocr("nleftrightarrow", "&nleftrightarrow;", "&#x21AE;", nleftrightarrow_code);
-    mk_ocr("nrightarrow", "&nrightarrow;", "&#x219B;", nrightarrow_code);
-    mk_ocr("approxeq", "&approxeq;", "&#x224A;", approxeq_code);
-    mk_ocr("Subset", "&Subset;", "&#x22D0;", Subset_code);
-    mk_ocr("Supset", "&Supset;", "&#x22D1;", Supset_code);
-    mk_ocr("blacktriangleleft", "&blacktriangleleft;", "&#x25C2;", blacktriangleleft_code);
-    mk_ocr("blacktriangleright", "&blacktriangleright;", "&#x25B8;", blacktriangleright_code);
-    mk_ocr("triangledown", "&triangledown;", "&#x25BF;", triangledown_code);
-    mk_ocr("circlearrowleft", "&#x2940;", "&#x2940;", circlearrowleft_code);
-    mk_ocr("circlearrowright", "&#x2941;", "&#x2941;", circlearrowright_code);
-    mk_ocr("curvearrowleft", "&#x293A;", "&#x293A;", curvearrowleft_code);
-    mk_ocr("curvearrowright", "&#x293B;", "&#x293b;", curvearrowright_code);
-    mk_ocr("dasharrow", "&rBarr;", "&#x290F;", dasharrow_code);
-    mk_ocr("dashleftarrow", "&lBarr;", "&#x290E;", dashleftarrow_code);
-    mk_ocr("dashrightarrow", "&rBarr;", "&#x290F;", dashrightarrow_code);
-    mk_ocr("fatsemi", "&#x2A1F;", "&#x2A1F;", fatsemi_code);
-    mk_ocr("downdownarrows", "&downdownarrows;", "&#x21CA;", downdownarrows_code);
-    mk_ocr("downharpoonright", "&downharpoonright;", "&#x21C2;", downharpoonright_code);
-    mk_ocr("downharpoonleft", "&downharpoonleft;", "&#x21C3;", downharpoonleft_code);
-    mk_ocr("leftarrowtail", "&leftarrowtail;", "&#x21A2;", leftarrowtail_code);
-    mk_ocr("rightarrowtail", "&rightarrowtail;", "&#x21A3;", rightarrowtail_code);
-    mk_ocr("leftarrowtriangle", "&loarr;", "&#x21FD;", leftarrowtriangle_code);
-    mk_ocr("rightarrowtriangle", "&roarr;", "&#x21FE;", rightarrowtriangle_code);
-    mk_ocr("leftrightarrowtriangle", "&hoarr;", "&#x21FF;", leftrightarrowtriangle_code);
-    mk_ocr("leftleftarrows", "&leftleftarrows;", "&#x21C7;", leftleftarrows_code);
-    mk_ocr("upuparrows", "&upuparrows;", "&#x21C8;", upuparrows_code);
-    mk_ocr("rightrightarrows", "&rightrightarrows;", "&#x21C9;", rightrightarrows_code);
-    mk_ocr("leftrightarrows", "&leftrightarrows;", "&#x21C6;", leftrightarrows_code);
-    mk_ocr("leftrightharpoons", "&leftrightharpoons;", "&#x21CB;", leftrightharpoons_code);
-    mk_ocr("leftrightsquigarrow", "&leftrightsquigarrow;", "&#x21AD;", leftrightsquigarrow_code);
-    mk_ocr("Lleftarrow", "&Lleftarrow;", "&#x21DA;", Lleftarrow_code);
-    mk_ocr("Rrightarrow", "&Rrightarrow;", "&#x21DB;", Rrightarrow_code);
-    mk_ocr("Longmapsfrom", "&#x27FD;", "&#x27FD;", Longmapsfrom_code);
-    mk_ocr("longmapsfrom", "&#x27FB;", "&#x27FB;", longmapsfrom_code);
-    mk_ocr("Mapsfrom", "&#x2906;", "&#x2906;", Mapsfrom_code);
-    mk_ocr("Longmapsto", "&#x27FE;", "&#x27FE;", Longmapsto_code);
-    mk_ocr("Mapsto", "&#x2907;", "&#x2907;", Mapsto_code);
-    mk_ocr("mapsfrom", "&mapstoleft;", "&#x21A4;", mapsfrom_code);
-    mk_ocr("longmapsto", "&longmapsto;", "&#x27FC;", longmapsto_code);
-    mk_ocr("looparrowleft", "&looparrowleft;", "&#x21AB;", looparrowleft_code);
-    mk_ocr("looparrowright", "&looparrowright;", "&#x21AC;", looparrowright_code);
-    mk_ocr("Lsh", "&Lsh;", "&#x21B0;", Lsh_code);
-    mk_ocr("Rsh", "&Rsh;", "&#x21B1;", Rsh_code);
-    mk_ocr("rightleftarrows", "&rightleftarrows;", "&#x21C4;", rightleftarrows_code);
-    mk_ocr("rightleftharpoons", "&rightleftharpoons;", "&#x21CC;", rightleftharpoons_code);
-    mk_ocr("rightsquigarrow", "&rightsquigarrow;", "&#x21DD;", rightsquigarrow_code);
-    mk_ocr("twoheadleftarrow", "&twoheadleftarrow;", "&#x219E;", twoheadleftarrow_code);
-    mk_ocr("twoheadrightarrow", "&twoheadrightarrow;", "&#x21A0;", twoheadrightarrow_code);
-    mk_ocr("upharpoonleft", "&upharpoonleft;", "&#x21BF;", upharpoonleft_code);
-    mk_ocr("upharpoonright", "&upharpoonright;", "&#x21BE;", upharpoonright_code);
-    mk_ocr("varprime", "&prime;", "&#x2032;", varprime_code); // vprime in isoamso,
-    mk_ocr("Prime", "&Prime;", "&#x2033;", Prime_code);
-    mk_ocr("tprime", "&tprime;", "&#x2034;", tprime_code);
-    mk_ocr("bprime", "&backprime;", "&#x2035;", bprime_code);
-    mk_ocr("qprime", "&qprime;", "&#x2057;", qprime_code);
-    mk_ocr("veebar", "&veebar;", "&#x22BB;", veebar_code);
-    mk_ocr("backsimeq", "&backsimeq;", "&#x22CD;", backsimeq_code);
-    mk_ocr("backsim", "&backsim;", "&#x223D;", backsim_code);
-    mk_ocr("Bumpeq", "&Bumpeq;", "&#x224E;", Bumpeq_code);
-    mk_ocr("bumpeq", "&bumpeq;", "&#x224F;", bumpeq_code);
-    mk_ocr("circeq", "&circeq;", "&#x2257;", circeq_code);
-    mk_ocr("curlyeqprec", "&curlyeqprec;", "&#x22DE;", curlyeqprec_code);
-    mk_ocr("curlyeqsucc", "&curlyeqsucc;", "&#x22DF;", curlyeqsucc_code);
-    mk_ocr("Doteq", "&doteqdot;", "&#x2251;", Doteq_code);
-    mk_ocr("doteqdot", "&doteqdot;", "&#x2251;", doteqdot_code);
-    mk_ocr("eqcirc", "&eqcirc;", "&#x2256;", eqcirc_code);
-    mk_ocr("eqsim", "&eqsim;", "&#x2242;", eqsim_code);
-    mk_ocr("eqslantgtr", "&eqslantgtr;", "&#x2A96;", eqslantgtr_code);
-    mk_ocr("eqslantless", "&eqslantless;", "&#x2A95;", eqslantless_code);
-    mk_ocr("fallingdotseq", "&fallingdotseq;", "&#x2252;", fallingdotseq_code);
-    mk_ocr("risingdotseq", "&risingdotseq;", "&#x2253;", risingdotseq_code);
-    mk_ocr("geqq", "&geqq;", "&#x2267;", geqq_code);
-    mk_ocr("leqq", "&leqq;", "&#x2266;", leqq_code);
-    mk_ocr("gggtr", "&ggg;", "&#x22D9;", gggtr_code);
-    mk_ocr("ggg", "&ggg;", "&#x22D9;", ggg_code);
-    mk_ocr("lll", "&Ll;", "&#x22D8;", lll_code);
-    mk_ocr("llless", "&Ll;", "&#x22D8;", llless_code);
-    mk_ocr("gtrapprox", "&gtrapprox;", "&#x2A86;", gtrapprox_code);
-    mk_ocr("lessapprox", "&lessapprox;", "&#x2A85;", lessapprox_code);
-    mk_ocr("gtreqless", "&gtreqless;", "&#x22DB;", gtreqless_code);
-    mk_ocr("gtreqqless", "&gtreqqless;", "&#x2A8C;", gtreqqless_code);
-    mk_ocr("lesseqgtr", "&lesseqgtr;", "&#x22DA;", lesseqgtr_code);
-    mk_ocr("lesseqqgtr", "&lesseqqgtr;", "&#x2A8B;", lesseqqgtr_code);
-    mk_ocr("lessgtr", "&lessgtr;", "&#x2276;", lessgtr_code);
-    mk_ocr("lesssim", "&lesssim;", "&#x2272;", lesssim_code);
-    mk_ocr("gtrsim", "&gtrsim;", "&#x2273;", gtrsim_code);
-    mk_ocr("precapprox", "&precapprox;", "&#x2AB7;", precapprox_code);
-    mk_ocr("succapprox", "&succapprox;", "&#x2AB8;", succapprox_code);
-    mk_ocr("succcurlyeq", "&succcurlyeq;", "&#x227D;", succcurlyeq_code);
-    mk_ocr("succsim", "&succsim;", "&#x227F;", succsim_code);
-    mk_ocr("preccurlyeq", "&preccurlyeq;", "&#x227C;", preccurlyeq_code);
-    // mk_ocr("leftrightarroweq","&gtrsim;", "&#x2273;",leftrightarroweq_code);
-    mk_ocr("gnapprox", "&gnapprox;", "&#x2A8A;", gnapprox_code);
-    mk_ocr("lnapprox", "&lnapprox;", "&#x2A89;", lnapprox_code);
-    mk_ocr("gneqq", "&gneqq;", "&#x2269;", gneqq_code);
-    mk_ocr("lneqq", "&lneqq;", "&#x2268;", lneqq_code);
-    mk_ocr("gneq", "&gneq;", "&#x2A88;", gneq_code);
-    mk_ocr("lneq", "&lneq;", "&#x2A87;", lneq_code);
-    mk_ocr("gnsim", "&gnsim;", "&#x22E7;", gnsim_code);
-    mk_ocr("lnsim", "&lnsim;", "&#x22E6;", lnsim_code);
-    mk_ocr("ngeq", "&ngeq;", "&#x2271;", ngeq_code);
-    mk_ocr("ngtr", "&ngtr;", "&#x226F;", ngtr_code);
-    mk_ocr("nleq", "&nleq;", "&#x2270;", nleq_code);
-    mk_ocr("nless", "&nless;", "&#x226E;", nless_code);
-    mk_ocr("nprec", "&nprec;", "&#x2280;", nprec_code);
-    mk_ocr("nsim", "&nsim;", "&#x2241;", nsim_code);
-    mk_ocr("nsucc", "&nsucc;", "&#x2281;", nsucc_code);
-    mk_ocr("precnapprox", "&precnapprox;", "&#x2AB9;", precnapprox_code);
-    mk_ocr("precneqq", "&precneqq;", "&#x2AB5;", precneqq_code);
-    mk_ocr("precnsim", "&precnsim;", "&#x22E8;", precnsim_code);
-    mk_ocr("precsim", "&precsim;", "&#x227E;", precsim_code);
-    mk_ocr("succnapprox", "&succnapprox;", "&#x2ABA;", succnapprox_code);
-    mk_ocr("succneqq", "&succneqq;", "&#x2AB6;", succneqq_code);
-    mk_ocr("succnsim", "&succnsim;", "&#x22E9;", succnsim_code);
-    mk_ocr("inplus", "&loplus;", "&#x2A2D;", inplus_code);
-    mk_ocr("niplus", "&roplus;", "&#x2A2E;", niplus_code);
-    mk_ocr("ntrianglerighteqslant", "&ntrianglerighteq;", "&#x22ED;", ntrianglerighteqslant_code);
-    mk_ocr("ntrianglelefteqslant", "&ntrianglelefteq;", "&#x22EC;", ntrianglelefteqslant_code);
-    mk_ocr("subseteqq", "&subseteqq;", "&#x2AC5;", subseteqq_code);
-    mk_ocr("supseteqq", "&supseteqq;", "&#x2AC6;", supseteqq_code);
-    mk_ocr("vartriangleleft", "&vartriangleleft;", "&#x22B2;", vartriangleleft_code);
-    mk_ocr("vartriangleright", "&vartriangleright;", "&#x22B3;", vartriangleright_code);
-    mk_ocr("trianglerighteq", "&trianglerighteq;", "&#x22B5;", trianglerighteq_code);
-    mk_ocr("trianglelefteq", "&trianglelefteq;", "&#x22B4;", trianglelefteq_code);
-    mk_ocr("nsubseteq", "&nsubseteq;", "&#x2288;", nsubseteq_code);
-    mk_ocr("nsupseteq", "&nsupseteq;", "&#x2289;", nsupseteq_code);
-    mk_ocr("ntrianglelefteq", "&ntrianglelefteq;", "&#x22EC;", ntrianglelefteq_code);
-    mk_ocr("ntrianglerighteq", "&ntrianglerighteq;", "&#x22ED;", ntrianglerighteq_code);
-    mk_ocr("ntriangleleft", "&ntriangleleft;", "&#x22EA;", ntriangleleft_code);
-    mk_ocr("ntriangleright", "&ntriangleright;", "&#x22EB;", ntriangleright_code);
-    mk_ocr("subsetneqq", "&subsetneqq;", "&#x2ACB;", subsetneqq_code);
-    mk_ocr("supsetneqq", "&supsetneqq;", "&#x2ACC;", supsetneqq_code);
-    mk_ocr("subsetneq", "&subsetneq;", "&#x228A;", subsetneq_code);
-    mk_ocr("supsetneq", "&supsetneq;", "&#x228B;", supsetneq_code);
-
-    mk_oc("rrbracket", "&RightDoubleBracket;", "&#x301B;", rrbracket_code);
-    mk_oc("llbracket", "&LeftDoubleBracket;", "&#x301A;", llbracket_code);
-    mk_oc("binampersand", "&amp;", "&amp;", binampersand_code);
-    // duplicate
-    mk_oc("bindnasrepma", "&#x214B;", "&#x214B;", bindnasrepma_code);
-    mk_oc("llparenthesis", "&#x2987;", "&#x2987;", llparenthesis_code);
-    mk_oc("rrparenthesis", "&#x2988;", "&#x2988;", rrparenthesis_code);
-
-    // mk_oc("ldots","...");
-    mk_oc("cdots", "&ctdot;", "&#x022EF;", cdots_code, mathinner_cmd, false);
-    //  mk_oc("dots","&ctdot;");
-    mk_oc("hdots", "&ctdot;", "&#x022EF;", hdots_code, mathinner_cmd, false);
-    mk_oc("vdots", "&vellip;", "&#x022EE;", vdots_code, mathinner_cmd, false);
-    mk_oc("ddots", "&dtdot;", "&#x022F1;", ddots_code, mathinner_cmd, false);
-    mk_oc("imath", "&imath;", "&#x00131;", imath_code, mathord_cmd, false);
-    mk_oc("jmath", "&jmath;", "&#x0006A;", jmath_code, mathord_cmd, false);
-    mk_oc("@Vert", "&Verbar;", "&#x02016;", Vertx_code, mathbetween_cmd, false);
-    mk_oc("|", "&parallel;", "&#x02225;", Vert_code, mathbetween_cmd, false);
-    mk_oc("Vert", "&parallel;", "&#x02225;", Vert_code, mathbetween_cmd, false);
     eval_let("Arrowvert", "Vert");
-    mk_oc("lVert", "&parallel;", "&#x02225;", Vert_code, mathopen_cmd, false);
-    mk_oc("rVert", "&parallel;", "&#x02225;", Vert_code, mathclose_cmd, false);
-    mk_oc("vert", "&vert;", "&#x7C;", vert_code, mathbetween_cmd, false);
     eval_let("arrowvert", "vert");
     eval_let("bracevert", "vert"); // U+23AA ?
-    mk_oc("lvert", "&vert;", "&#x7C;", vert_code, mathopen_cmd, false);
-    mk_oc("rvert", "&vert;", "&#x7C;", vert_code, mathclose_cmd, false);
-    mk_oc("uparrow", "&uparrow;", "&#x02191;", uparrow_code, mathbetween_cmd, true);
-    mk_oc("downarrow", "&downarrow;", "&#x02193;", downarrow_code, mathbetween_cmd, true);
-    mk_oc("Uparrow", "&Uparrow;", "&#x021D1;", Uparrow_code, mathbetween_cmd, true);
-    mk_oc("Downarrow", "&Downarrow;", "&#x021D3;", Downarrow_code, mathbetween_cmd, true);
-    mk_oc("Updownarrow", "&Updownarrow;", "&#x021D5;", Updownarrow_code, mathbetween_cmd, true);
-    mk_oc("updownarrow", "&updownarrow;", "&#x02195;", updownarrow_code, mathbetween_cmd, true);
-    mk_oc("backslash", "&Backslash;", "&#x2216;", backslash_code, mathbetween_cmd, false);
-    mk_oc("mho", "&mho;", "&#x02127;", mho_code);
-    mk_oc("DifferentialD", "&DifferentialD;", "&#x2146;", differentiald_code);
-    mk_oc("leadsto", "&#x21DD;", "&#x21DD;", leadsto_code);
-    mk_oc("lhd", "&#x22B2;", "&#x22B2;", lhd_code);
-    mk_oc("rhd", "&#x22B3;", "&#x22B3;", rhd_code);
-    mk_oc("unlhd", "&#x22B4;", "&#x22B4;", unlhd_code);
-    mk_oc("unrhd", "&#x22B5;", "&#x22B5;", unrhd_code);
-    mk_oc("clubsuit", "&clubsuit;", "&#x02663;", clubsuit_code);
-    mk_oc("diamondsuit", "&diamondsuit;", "&#x02666;", diamondsuit_code);
-    mk_oc("heartsuit", "&heartsuit;", "&#x02665;", heartsuit_code);
-    mk_oc("spadesuit", "&spadesuit;", "&#x02660;", spadesuit_code);
-    mk_oc("Box", "&#x25A1;", "&#x25A1;", Box_code);
-    mk_oc("rangle", "&rangle;", RANGLE, rangle_code, mathclose_cmd, true);
-    mk_oc("langle", "&langle;", LANGLE, langle_code, mathopen_cmd, true);
-    mk_oc("varrangle", "&rangle;", "&#x27E9;", varrangle_code, mathclose_cmd, false);
-    mk_oc("varlangle", "&langle;", "&#x27E8;", varlangle_code, mathopen_cmd, false);
-    mk_oc("rmoustache", "&rmoustache;", "&#x023B1;", rmoustache_code, mathclose_cmd, false);
-    mk_oc("lmoustache", "&lmoustache;", "&#x023B0;", lmoustache_code, mathopen_cmd, false);
-    mk_oc("rgroup", "&#x3015;", "&#x3015;", rgroup_code, mathclose_cmd, false);
-    mk_oc("lgroup", "&#x3014;", "&#x3014;", lgroup_code, mathopen_cmd, false);
-    mk_oc("rbrace", "&rbrace;", "&#x0007D;", rbrace_code, mathclose_cmd, true);
-    mk_oc("lbrace", "&lbrace;", "&#x0007B;", lbrace_code, mathopen_cmd, true);
-    mk_oc("lceil", "&lceil;", "&#x02308;", lceil_code, mathopen_cmd, false);
-    mk_oc("rceil", "&rceil;", "&#x02309;", rceil_code, mathclose_cmd, false);
-    mk_oc("lfloor", "&lfloor;", "&#x0230A;", lfloor_code, mathopen_cmd, false);
-    mk_oc("rfloor", "&rfloor;", "&#x0230B;", rfloor_code, mathclose_cmd, false);
-
-    mk_oc("square", "&square;", "&#x025A1;", square_code);
-    mk_oc("cong", "&cong;", "&#x02245;", cong_code);
-    mk_oc("ncong", "&#x2247;", "&#x02247;", ncong_code);
-    mk_oc("lnot", "&not;", "&#xAC;", not_code);
     eval_let("neg", "lnot");
-
-    mk_ocb("in", "&Element;", "&#x02208;", in_code);
     mk_gen("math{", "{", "{", open_brace_code, "mo", mathopen_cmd, true);
     mk_gen("math}", "}", "}", close_brace_code, "mo", mathclose_cmd, true);
     mk_oc("prime", "&apos;", "&#x27;", prime_code);
@@ -10,13 +10,16 @@
 
 // This file contains the TeX parser of tralics
 
+#include "tralics/EventTrace.h"
 #include "tralics/Logger.h"
 #include "tralics/MathHelper.h"
+#include "tralics/Profiler.h"
 #include "tralics/SaveAux.h"
 #include "tralics/Saver.h"
 #include "tralics/util.h"
 #include <fmt/format.h>
 #include <fmt/ostream.h>
+#include <deque>
 
 namespace {
     struct SpecialHash : public std::unordered_map<std::string, std::string> {
@@ -56,6 +59,25 @@ namespace {
     }
 
     Buffer trace_buffer, Thbuf2;
+
+    // Buffer for a name built by \csname and friends. Buffers are reused,
+    // one per nesting level, since the expansion of a name may contain
+    // another \csname.
+    class NameBuffer {
+        static inline std::deque<Buffer> pool;
+        static inline size_t             depth{0};
+
+    public:
+        Buffer &b;
+
+        NameBuffer() : b(depth < pool.size() ? pool[depth] : pool.emplace_back()) {
+            ++depth;
+            b.clear();
+        }
+        NameBuffer(const NameBuffer &) = delete;
+        auto operator=(const NameBuffer &) -> NameBuffer & = delete;
+        ~NameBuffer() { --depth; }
+    };
 } // namespace
 
 namespace token_ns {
@@ -646,7 +668,7 @@ auto Parser::vb_tokens(char32_t test, TokenList &L, bool before) -> bool {
         if (at_eol()) return true;
         char32_t c = get_next_char();
         if (c == test) break;
-        res.push_back(verbatim_chars[c]);
+        res.push_back(c < nb_characters ? verbatim_chars[c] : Token(other_t_offset, c));
     }
     if (res.empty() && !before) res.push_back(hash_table.tilda_token);
     res.push_front(hash_table.verbatim_font);
@@ -826,7 +848,6 @@ auto Parser::delimiter_for_saveverb() -> char32_t {
         if (at_eol()) return char32_t();
         char32_t c = get_next_char();
         if (c == 0) return c;
-        if (c > 65535) return char32_t();
         if (get_catcode(c) == space_catcode) continue;
         if (get_catcode(c) == special_catcode) return c;
         return char32_t();
@@ -1410,10 +1431,6 @@ auto Parser::grab_env_comma(TokenList &v) -> bool {
 // This is macro_call in TeX
 // Assumes that cur_tok holds the macro name, the argument the value.
 void Parser::expand_mac(Macro &X) {
-    if (tracing_macros()) {
-        Logger::finish_seq();
-        the_log << " " << X << "\n";
-    }
     def_type spec = X.type;
     if (spec == dt_empty) return;
     if (skip_prefix(X[0])) return;
@@ -1445,10 +1462,16 @@ void Parser::expand_mac(Macro &X) {
                     arguments[1] = X[1];
             }
         }
-        if (tracing_macros()) the_log << "#" << i << "<-" << arguments[i] << "\n";
+        if (tracing_macros()) {
+            if (event_trace.enabled)
+                event_trace.argument(i, arguments[i]);
+            else
+                the_log << "#" << i << "<-" << arguments[i] << "\n";
+        }
     }
     TokenList res = X.body.expand_mac_inner(arguments.data()); // \todo pass the array instead
     if (spec == dt_brace) res.push_back(hash_table.OB_token);
+    if (profiler.enabled) profiler.body_start(TL.size());
     back_input(res);
 }
 
@@ -1458,6 +1481,7 @@ void Parser::expand_mac(Macro &X) {
 // returns true if bad; fills the buffer b until finding \endcsname
 auto Parser::list_to_string0(Buffer &b) -> bool {
     for (;;) {
+        if (TL.empty() && !restricted) name_chars_from_line(b);
         if (get_x_token()) return true;
         if (cur_cmd_chr.cmd == endcsname_cmd) return false;
         if (cur_tok.not_a_cmd()) {
@@ -1525,7 +1549,8 @@ auto Parser::my_csname(String s1, String s2, TokenList &L, String s) -> bool {
         Logger::finish_seq();
         the_log << "{" << s << "}\n";
     }
-    Buffer b;
+    NameBuffer nb;
+    Buffer    &b = nb.b;
     b.append(s1);
     bool r = list_to_string(L, b);
     b.append(s2);
@@ -1539,7 +1564,8 @@ auto Parser::my_csname(String s1, String s2, TokenList &L, String s) -> bool {
 
 // Same as above; but converts the result into the string fetch_name_res
 void Parser::fetch_name2() {
-    Buffer b;
+    NameBuffer nb;
+    Buffer    &b = nb.b;
     if (list_to_string0(b)) {
         if (cur_tok.is_valid()) back_input();
         bad_csname(false);
@@ -1568,7 +1594,8 @@ void Parser::finish_csname(const Buffer &b, const std::string &s) {
 
 // This interprets \csname ... \endcsname; token is to be read again
 void Parser::E_csname() {
-    Buffer b;
+    NameBuffer nb;
+    Buffer    &b = nb.b;
     if (tracing_commands()) Logger::log_dump("csname");
     if (list_to_string0(b)) {
         if (cur_tok.is_valid()) back_input();
@@ -2526,14 +2553,21 @@ void Parser::E_random() {
 }
 
 void Parser::E_user(bool vb, subtypes c, symcodes C) {
+    auto &X = mac_table.get_macro(c);
+    if (profiler.enabled) profiler.open_macro(cur_tok);
     if (vb) {
-        Logger::finish_seq();
-        the_log << cur_tok;
+        if (event_trace.enabled)
+            event_trace.macro(cur_tok, c, X);
+        else {
+            Logger::finish_seq();
+            the_log << cur_tok << " " << X << "\n";
+        }
     }
     auto guard1 = SaveScannerStatus(ss_macro);
     auto guard2 = SaveLongState(ls_normal);
     if (C == userl_cmd || C == userlo_cmd || C == userlp_cmd || C == userlpo_cmd) long_state = ls_long;
-    expand_mac(mac_table.get_macro(c));
+    expand_mac(X);
+    if (profiler.enabled) profiler.body_end();
 }
 
 void Parser::E_first_of_two(bool vb, subtypes c) {
@@ -2797,6 +2831,7 @@ void Parser::pass_text(Token Tfe) {
     int  l     = 0;
     auto guard = SaveScannerStatus(ss_skipping);
     for (;;) {
+        if (TL.empty() && !restricted) skip_inert_text();
         if (get_token()) {
             cur_tok     = hash_table.fi_token;
             cur_cmd_chr = CmdChr(fi_or_else_cmd, fi_code);
@@ -3303,14 +3338,14 @@ void Parser::assign_def_something(bool gbl) {
     else if (offset == del_code_offset)
         n = 077777777;
     else if (offset == lc_code_offset || offset == uc_code_offset)
-        n = nb_characters - 1;
+        n = nb_unicode - 1;
     else
         n = 0; // This should not happen
-    auto k = to_signed(scan_char_num());
-    offset += to_unsigned(k);
+    bool del = offset == del_code_offset;
+    offset   = char_code_pos(offset, scan_unicode_num());
     scan_optional_equals();
-    k = scan_int(T);
-    if ((k < 0 && offset < del_code_offset) || k > n) {
+    auto k = scan_int(T);
+    if ((k < 0 && !del) || k > n) {
         signal_ovf(T, "Invalid code (out of bounds)\n", k, n);
         k = 0;
     }
@@ -137,7 +137,7 @@ auto Parser::ok_to_define(Token a, rd_flag redef) -> bool {
 
 // Define for an integer quantity. Like eq_define without reference counts.
 void Parser::word_define(size_t a, long c, bool gbl) {
-    EqtbInt &W        = eqtb_int_table[a];
+    EqtbInt &W        = eqtb_int(a);
     bool     reassign = !gbl && W.val == c;
     if (tracing_assigns()) {
         CmdChr tmp(assign_int_cmd, subtypes(a));
@@ -13,6 +13,8 @@
 #include "tralics/InputStack.h"
 #include "tralics/Logger.h"
 #include "tralics/MainClass.h"
+#include "tralics/PhaseTimer.h"
+#include "tralics/Profiler.h"
 #include "tralics/Saver.h"
 #include "tralics/ScanSlot.h"
 #include "tralics/TexFonts.h"
@@ -189,6 +191,7 @@ auto Parser::is_input_open() -> bool {
 void Parser::push_input_stack(const std::string &name, bool restore_at, bool re) {
     auto *W = new InputStack(name, get_cur_line(), state, cur_file_pos, every_eof, require_eof);
     cur_input_stack.push_back(W);
+    if (phase_timer.files) phase_timer.begin(name, "input");
     auto n = cur_input_stack.size();
     if (tracing_io()) {
         Logger::finish_seq();
@@ -198,6 +201,7 @@ void Parser::push_input_stack(const std::string &name, bool restore_at, bool re)
     W->line_pos = input_line_pos;
     W->line     = input_line;
     W->TL.swap(TL);
+    if (profiler.enabled) profiler.enter_list();
     if (restore_at) {
         W->at_val                      = eqtb_int_table[uchar('@')].val;
         eqtb_int_table[uchar('@')].val = 11;
@@ -240,6 +244,7 @@ void Parser::pop_input_stack(bool vb) {
     input_line.clear();
     input_line.insert(input_line.end(), W->line.begin(), W->line.end());
     input_line_pos = W->line_pos;
+    if (profiler.enabled) profiler.leave_list();
     back_input(W->TL);
     if (cur_file_pos != 0) insert_hook(cur_file_pos);
     cur_file_pos = W->file_pos;
@@ -247,6 +252,7 @@ void Parser::pop_input_stack(bool vb) {
     Logger::finish_seq();
     the_log << "++ cur_file_pos restored to " << cur_file_pos << "\n";
     cur_input_stack.pop_back();
+    if (phase_timer.files) phase_timer.end("input");
     if (tracing_io()) {
         Logger::finish_seq();
         the_log << "++ Input stack -- " << n << " " << W->name << "\n";
@@ -395,7 +401,7 @@ void Parser::T_input(subtypes q) {
         res = find_in_path(file);
         if ((!res) && (!file.ends_with(".tex"))) res = find_in_path(file + ".tex");
     }
-    if (res) spdlog::trace("Found file for input: {}", *res);
+    if (res) Logger::trace("Found file for input: {}", *res);
     if (q == openin_code) {
         tex_input_files[stream].open(file, *res, static_cast<bool>(res));
         return;
@@ -487,10 +493,6 @@ auto Parser::cs_from_input() -> Token {
     if (at_eol()) return Token(null_tok_val);
     char32_t c = get_next_char();
     state      = state_S;
-    if (c > 65535) { // abort and return null_cs
-        --input_line_pos;
-        return Token(null_tok_val);
-    }
     auto C = get_catcode(c);
     if (C == letter_catcode) {
         Buffer B;
@@ -498,10 +500,6 @@ auto Parser::cs_from_input() -> Token {
         for (;;) {
             if (at_eol()) break;
             c = get_next_char();
-            if (c > 65535) {
-                --input_line_pos;
-                break;
-            } // abort
             C = get_catcode(c);
             if (C == letter_catcode) {
                 B.push_back(c);
@@ -525,6 +523,102 @@ auto Parser::cs_from_input() -> Token {
     return Token(c + single_offset);
 }
 
+// Fast path of pass_text. Moves forward in the current line over the
+// characters and commands that pass_text would ignore, without creating
+// tokens; as in TeX, unknown command names are not entered in the hash
+// table. Stops before a conditional, an outer command, and everything
+// that needs next_from_line (end of line, comments, ^^ sequences, etc).
+void Parser::skip_inert_text() {
+    static auto &map   = Hashtab::the_map();
+    static auto &eqtb  = Hashtab::the_eqtb();
+    auto         inert = [](Token t) {
+        auto it = eqtb.find(t.eqtb_loc());
+        if (it == eqtb.end()) return true;
+        auto cmd = it->second.val.cmd;
+        return cmd != if_test_cmd && cmd != fpif_cmd && cmd != fi_or_else_cmd && !it->second.val.is_outer();
+    };
+    auto   n = input_line.size();
+    Buffer B;
+    while (input_line_pos < n) {
+        char32_t c = input_line[input_line_pos];
+        switch (get_catcode(c)) {
+        case space_catcode:
+            if (state == state_M) state = state_S;
+            break;
+        case open_catcode:
+        case close_catcode:
+        case dollar_catcode:
+        case alignment_catcode:
+        case parameter_catcode:
+        case underscore_catcode:
+        case letter_catcode:
+        case other_catcode: state = state_M; break;
+        case active_catcode: {
+            Token t;
+            t.active_char(c);
+            if (!inert(t)) return;
+            state = state_M;
+            break;
+        }
+        case escape_catcode: {
+            auto q = input_line_pos + 1;
+            if (q == n) return;
+            c      = input_line[q++];
+            auto C = get_catcode(c);
+            if (C == hat_catcode) return;
+            Token t(c + single_offset);
+            state = C == letter_catcode || C == space_catcode ? state_S : state_M;
+            if (C == letter_catcode) {
+                B.clear();
+                B.push_back(c);
+                while (q < n && get_catcode(input_line[q]) == letter_catcode) B.push_back(input_line[q++]);
+                if (q < n && get_catcode(input_line[q]) == hat_catcode) return;
+                if (q > input_line_pos + 2) {
+                    auto it = map.find(B);
+                    if (it == map.end() && hash_table.lazy_primitives.contains(B)) return;
+                    t = it == map.end() ? Token() : Token(it->second + hash_offset);
+                }
+            }
+            if (!t.is_null() && !inert(t)) return;
+            input_line_pos = q;
+            continue;
+        }
+        default: return;
+        }
+        input_line_pos++;
+    }
+}
+
+// Fast path of list_to_string0. Puts in b the characters of the current
+// line that would be read as character tokens, without making tokens.
+// Stops before commands, active characters, end of line, etc.
+void Parser::name_chars_from_line(Buffer &b) {
+    auto n = input_line.size();
+    for (; input_line_pos < n; input_line_pos++) {
+        char32_t c = input_line[input_line_pos];
+        switch (get_catcode(c)) {
+        case space_catcode:
+            if (state == state_M) {
+                b.push_back(char32_t(' '));
+                state = state_S;
+            }
+            break;
+        case open_catcode:
+        case close_catcode:
+        case dollar_catcode:
+        case alignment_catcode:
+        case parameter_catcode:
+        case underscore_catcode:
+        case letter_catcode:
+        case other_catcode:
+            b.push_back(c);
+            state = state_M;
+            break;
+        default: return;
+        }
+    }
+}
+
 // This constructs a new token by reading characters from the buffer.
 // Returns true in case of problem. Either because we are at EOL
 // or because a line ended (% or \n), or because a character was ignored
@@ -532,14 +626,6 @@ auto Parser::cs_from_input() -> Token {
 auto Parser::next_from_line0() -> bool {
     if (at_eol()) return true;
     char32_t c = get_next_char();
-    if (c > 65535) { // convert to \char"ABCD
-        back_input(hash_table.space_token);
-        auto s = fmt::format("\"{:X}", size_t(c));
-        for (auto k = s.size(); k > 0; --k) back_input(Token(other_t_offset, static_cast<uchar>(s[k - 1])));
-        state = state_M;
-        see_cs_token(hash_table.char_token);
-        return false;
-    }
     cur_cmd_chr = CmdChr(get_catcode(c), subtypes(c));
     switch (cur_cmd_chr.cmd) {
     case escape_catcode:
@@ -615,6 +701,7 @@ auto Parser::next_from_line() -> bool {
 // interpreted as a character of catcode 0; which is impossible.
 
 auto Parser::get_itoken() -> bool {
+    if (profiler.enabled) profiler.before_token(TL.size());
     if (!TL.empty()) {
         next_from_list();
         return false;
@@ -1101,6 +1188,9 @@ auto Parser::scan_27bit_int() -> size_t { return scan_int(cur_tok, (1 << 27) - 1
 
 auto Parser::scan_char_num() -> size_t { return scan_int(cur_tok, scan_char_num_max, "character code"); }
 
+// Like scan_char_num, for any code point
+auto Parser::scan_unicode_num() -> size_t { return scan_int(cur_tok, nb_unicode - 1, "character code"); }
+
 auto Parser::scan_fifteen_bit_int() -> size_t { return scan_int(cur_tok, 32767, "mathchar"); }
 
 // Scan a sign (plus, minus, spaces, etc.). After that cur_tok is the first
@@ -1407,8 +1497,8 @@ void Parser::scan_something_internal(internal_type level) {
         cur_val.set_dim(0);
         return;
     case def_code_cmd: // \catcode, \lccode etc
-        v = scan_char_num();
-        cur_val.set_int(eqtb_int_table[v + m].val);
+        v = scan_unicode_num();
+        cur_val.set_int(eqtb_int_val(char_code_pos(m, v)));
         return;
     case def_family_cmd:       // \textfont
     case set_font_cmd:         // a font (like \tenrm in plain)
@@ -1324,6 +1324,11 @@ auto CmdChr::token_assignint_name() const -> std::string {
         if (chr < count_reg_offset) return make_name("delcode", chr - del_code_offset);
         if (chr < mu_reg_offset) return make_name("count", chr - count_reg_offset);
         if (chr < other_int_offset) return make_name("mu", chr - mu_reg_offset);
+        if (chr >= integer_table_size) {
+            static const std::array<String, 6> tables{"catcode", "mathcode", "lccode", "uccode", "sfcode", "delcode"};
+            auto                               k = (chr - integer_table_size) / nb_unicode;
+            if (k < tables.size()) return make_name(tables[k], (chr - integer_table_size) % nb_unicode);
+        }
         return make_name("countref", chr);
     }
 }
@@ -11,6 +11,7 @@
 // This file contains a big part of the Tralics translator
 
 #include "tralics/ColSpec.h"
+#include "tralics/EventTrace.h"
 #include "tralics/Logger.h"
 #include "tralics/MainClass.h"
 #include "tralics/SaveAux.h"
@@ -87,6 +88,7 @@ void Parser::translate_all() {
     while (!get_x_token()) {
         if (tracing_commands()) translate02();
         if (!translate03()) throw EndOfData();
+        if (cur_cmd_chr.is_letter_other()) translate_run();
     }
     flush_buffer();
 }
@@ -118,6 +120,10 @@ void Parser::translate02() const {
         return;
     }
     if (cur_cmd_chr.is_letter_other()) return;
+    if (event_trace.enabled) {
+        event_trace.command(cur_cmd_chr);
+        return;
+    }
     Logger::finish_seq();
     the_log << "{";
     print_cmd_chr(cur_cmd_chr);
@@ -1027,11 +1033,9 @@ void Parser::append_glue(Token T, ScaledInt dimen, bool vert) {
 // Find a color in the stack, returns the id;
 // May add a new item to the stack
 auto translate_ns::find_color(const std::string &model, const std::string &value) -> std::string {
-    auto n = all_colors.size();
-    for (size_t i = 0; i < n; i++)
-        if (all_colors[i].compare(model, value)) return all_colors[i].get_id();
-    all_colors.emplace_back("", model, value);
-    return all_colors[n].get_id();
+    auto [it, inserted] = color_index.try_emplace(model + '\0' + value, all_colors.size());
+    if (inserted) all_colors.emplace_back("", model, value);
+    return all_colors[it->second].get_id();
 }
 
 // case of \color{red} or \color[rgb]{1,0,0}
@@ -1113,6 +1117,7 @@ void Parser::T_color(subtypes c) {
         // is \global\let \color@myred \colorN
         auto n = all_colors.size();
         all_colors.emplace_back(name, model, value);
+        color_index.try_emplace(model + '\0' + value, n);
         CmdChr v(color_cmd, subtypes(n + color_offset));
         eq_define(C.eqtb_loc(), v, true);
         if (tracing_assigns()) {
@@ -1664,7 +1669,7 @@ void Parser::T_case_shift(subtypes c) {
         }
         if (a.char_or_active()) {
             auto b  = a.chr_val();
-            auto cx = eqtb_int_table[b + offset].val;
+            auto cx = eqtb_int_val(char_code_pos(offset, b));
             if (cx != 0) {
                 res.push_back(Token(a.val - b + to_unsigned(cx)));
                 continue;
@@ -2019,6 +2024,10 @@ void Parser::T_xmladdatt(subtypes c) {
     std::string key = nT_arg_nopar();
     cur_tok         = T;
     std::string val = nT_arg_nopar();
+    if (Xml *e = the_stack.elt_from_id(n); e != nullptr && e->shared) {
+        parse_error(T, "Cannot modify a shared math element ", std::to_string(n));
+        return;
+    }
     if (key.empty()) {
         if (!force) return;
         Xml *e = the_stack.elt_from_id(n);
@@ -1,7 +1,9 @@
 #include "tralics/util.h"
 #include "tralics/MainClass.h"
 #include "tralics/Parser.h"
+#include "tralics/Utf8Decoder.h"
 #include "tralics/globals.h"
+#include <spdlog/spdlog.h>
 #include <sstream>
 #include <utf8.h>
 
@@ -103,7 +105,11 @@ auto remove_digits(std::string s) -> std::string {
 auto codepoints(const std::string &s) -> std::vector<char32_t> {
     cur_file_line = the_parser.get_cur_line();
     std::vector<char32_t> res;
-    for (auto it = s.begin(); it != s.end() && *it != 0;) res.emplace_back(utf8::next(it, s.end()));
+    size_t                bad = 0;
+    if (auto n = utf8_ns::decode_line(s, res, bad); n != 0) {
+        bad_chars += int(n);
+        spdlog::warn("{}:{}:{}: UTF-8 parsing error, ignoring {} char{}", cur_file_name, cur_file_line, bad + 1, n, n > 1 ? "s" : "");
+    }
     return res;
 }
 
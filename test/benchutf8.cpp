@@ -0,0 +1,77 @@
+// Microbenchmark for the UTF-8 decoder used for input lines.
+// Compares utf8_ns::decode_line with the per-character utf8::next loop
+// that was used before. Syntax is "bench_utf8 file..."
+
+#include "tralics/Utf8Decoder.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utf8.h>
+#include <vector>
+
+namespace {
+    auto read_lines(const char *name, std::vector<std::string> &lines) -> size_t {
+        std::ifstream f(name);
+        size_t        n = 0;
+        for (std::string s; std::getline(f, s);) {
+            n += s.size();
+            lines.push_back(std::move(s));
+        }
+        return n;
+    }
+
+    template <typename F> auto best_time(F f, int runs) -> double {
+        double best = 1e30;
+        for (int i = 0; i < runs; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            f();
+            std::chrono::duration<double, std::micro> d = std::chrono::steady_clock::now() - start;
+            best                                        = std::min(best, d.count());
+        }
+        return best;
+    }
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+    std::vector<std::string> lines;
+    size_t                   bytes = 0;
+    for (int i = 1; i < argc; ++i) bytes += read_lines(argv[i], lines);
+    if (lines.empty()) {
+        std::cerr << "usage: bench_utf8 file...\n";
+        return 1;
+    }
+    const int             runs = 20;
+    std::vector<char32_t> res;
+    size_t                chars = 0, errs = 0;
+
+    auto old_way = best_time(
+        [&] {
+            chars = 0;
+            for (const auto &s : lines) {
+                res.clear();
+                for (auto it = s.begin(); it != s.end() && *it != 0;) {
+                    try {
+                        res.push_back(char32_t(utf8::next(it, s.end())));
+                    } catch (utf8::exception &) { ++it; }
+                }
+                chars += res.size();
+            }
+        },
+        runs);
+    auto new_way = best_time(
+        [&] {
+            chars = errs = 0;
+            for (const auto &s : lines) {
+                size_t bad = 0;
+                errs += utf8_ns::decode_line(s, res, bad);
+                chars += res.size();
+            }
+        },
+        runs);
+
+    std::cout << lines.size() << " lines, " << bytes << " bytes, " << chars << " chars, " << errs << " errors\n";
+    std::cout << "utf8::next     " << old_way << " us (" << bytes / old_way << " MB/s)\n";
+    std::cout << "decode_line    " << new_way << " us (" << bytes / new_way << " MB/s)\n";
+}
@@ -0,0 +1,88 @@
+// Prints the .evt file written by tralics -trace_buffer, in the format
+// used by \tracingmacros and \tracingcommands in the transcript.
+// Syntax is "tracedecode [-l] file.evt"; with -l, each line starts with
+// the file name and line number of the event. See src/EventTrace.cpp for
+// the file format.
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr char     trace_magic[8] = {'T', 'R', 'A', 'C', 'E', 'X', 'T', '1'};
+    constexpr uint32_t no_span        = 0xFFFFFFFF;
+
+    enum Kind : uint32_t { ev_macro, ev_argument, ev_command };
+
+    struct Reader {
+        std::ifstream f;
+        bool          ok{true};
+
+        auto word() -> uint32_t {
+            uint32_t x = 0;
+            if (!f.read(reinterpret_cast<char *>(&x), sizeof(x))) ok = false;
+            return x;
+        }
+        // Reads a section of n words per item
+        auto words(std::vector<uint32_t> &V, size_t n) -> bool {
+            V.resize(n * word());
+            if (!V.empty() && !f.read(reinterpret_cast<char *>(V.data()), std::streamsize(V.size() * sizeof(uint32_t)))) ok = false;
+            return ok;
+        }
+    };
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+    bool        locations = argc == 3 && std::strcmp(argv[1], "-l") == 0;
+    const char *name      = argv[argc - 1];
+    if (argc != (locations ? 3 : 2)) {
+        std::cerr << "Syntax: tracedecode [-l] file.evt\n";
+        return 1;
+    }
+    Reader R{std::ifstream(name, std::ios::binary)};
+    char   magic[8];
+    if (!R.f.read(magic, sizeof(magic)) || std::memcmp(magic, trace_magic, sizeof(magic)) != 0) {
+        std::cerr << name << " is not an event trace\n";
+        return 1;
+    }
+    uint64_t nb_events = 0;
+    R.f.read(reinterpret_cast<char *>(&nb_events), sizeof(nb_events));
+
+    std::vector<std::string> strings(R.word());
+    for (auto &s : strings) {
+        s.resize(R.word());
+        R.f.read(s.data(), std::streamsize(s.size()));
+    }
+    std::vector<uint32_t> events, spans;
+    R.words(events, 7);
+    R.words(spans, 1);
+    if (!R.ok) {
+        std::cerr << name << " is truncated\n";
+        return 1;
+    }
+
+    auto str = [&strings](uint32_t k) -> const std::string & { return strings.at(k); };
+    auto nb  = events.size() / 7;
+    if (nb < nb_events) std::cout << "... (" << nb_events - nb << " events lost)\n";
+    for (size_t k = 0; k < nb; k++) {
+        const auto *e = &events[7 * k];
+        if (locations) std::cout << "[" << str(e[1]) << ":" << e[2] << "] ";
+        switch (e[0] & 0xFF) {
+        case ev_macro: std::cout << str(e[3]) << " " << str(e[4]) << "\n"; break;
+        case ev_command: std::cout << "{" << str(e[3]) << "}\n"; break;
+        case ev_argument:
+            std::cout << "#" << (e[0] >> 8) << "<-";
+            if (e[6] == no_span)
+                std::cout << "...";
+            else
+                for (uint32_t j = 0; j < e[6]; j++) std::cout << str(spans.at(e[5] + j));
+            std::cout << "\n";
+            break;
+        default: std::cerr << "Unknown event " << e[0] << "\n"; return 1;
+        }
+    }
+    return 0;
+}